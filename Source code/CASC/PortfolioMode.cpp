@@ -30,10 +30,18 @@
 #include "Shell/TheoryFinder.hpp"
 
 #include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <stdio.h>
 #include <cstdio>
 
+#include "Saturation/LemmaExchange.hpp"
+#include "Saturation/SliceProgress.hpp"
 #include "Saturation/ProvingHelper.hpp"
 
 #include "Kernel/Problem.hpp"
@@ -45,7 +53,8 @@
 using namespace Lib;
 using namespace CASC;
 
-PortfolioMode::PortfolioMode() : _slowness(1.0), _syncSemaphore(2) {
+PortfolioMode::PortfolioMode() : _slowness(1.0), _syncSemaphore(2),
+  _sharePreprocessing(false), _portfolioPid(0), _donorSocket(-1), _prbPreprocessed(false) {
   // We need the following two values because the way the semaphore class is currently implemented:
   // 1) dec is the only operation which is blocking
   // 2) dec is done in the mode SEM_UNDO, so is undone when a process terminates
@@ -144,7 +153,22 @@ bool PortfolioMode::searchForProof()
   // now all the cpu usage will be in children, we'll just be waiting for them
   Timer::setLimitEnforcement(false);
 
-  return performStrategy(property);
+  if (env.options->sharedPreprocessing()) {
+    // the zygotes are created by the slices, but must become our children
+    _portfolioPid = getpid();
+    _sharePreprocessing = System::registerAsChildSubreaper();
+  }
+
+  if (env.options->lemmaExchange()) {
+    Saturation::LemmaExchange::init();
+  }
+  if (env.options->adaptiveSlices()) {
+    Saturation::SliceProgress::init();
+  }
+
+  bool result = performStrategy(property);
+  killZygotes();
+  return result;
 }
 
 bool PortfolioMode::performStrategy(Shell::Property* property)
@@ -300,6 +324,11 @@ void PortfolioMode::getSchedules(Property& prop, Schedule& quick, Schedule& fall
 {
   CALL("PortfolioMode::getSchedules");
 
+  if(!env.options->scheduleFile().empty()) {
+    Schedules::getScheduleFromFile(env.options->scheduleFile(),prop,quick,fallback);
+    return;
+  }
+
   switch(env.options->schedule()) {
   case Options::Schedule::CASC_2019:
   case Options::Schedule::CASC:
@@ -395,6 +424,13 @@ void PortfolioSliceExecutor::runSlice(vstring sliceCode,int remainingTime)
   }
 }
 
+pid_t PortfolioSliceExecutor::spawnPrepared(vstring sliceCode,int remainingTime)
+{
+  CALL("PortfolioSliceExecutor::spawnPrepared");
+
+  return _mode->spawnPrepared(sliceCode, remainingTime);
+}
+
 /**
  * Run a schedule.
  * Return true if a proof was found, otherwise return false.
@@ -543,6 +579,9 @@ void PortfolioMode::runSlice(Options& strategyOpt)
   opt.setNormalize(false);
   opt.setForcedOptionValues();
   opt.checkGlobalOptionConstraints();
+  if (_donorSocket != -1) {
+    _portfolioOptions = new Options(*env.options);
+  }
   *env.options = opt; //just temporarily until we get rid of dependencies on env.options in solving
 
   if (outputAllowed()) {
@@ -551,7 +590,19 @@ void PortfolioMode::runSlice(Options& strategyOpt)
     env.endOutput();
   }
 
-  Saturation::ProvingHelper::runVampire(*_prb, opt);
+  if (_prbPreprocessed) {
+    // forked from a zygote
+    Saturation::ProvingHelper::runVampireSaturation(*_prb, opt);
+  }
+  else if (_donorSocket != -1) {
+    if (Saturation::ProvingHelper::runVampirePreprocessing(*_prb, opt)) {
+      startZygote();
+      Saturation::ProvingHelper::runVampireSaturation(*_prb, opt);
+    }
+  }
+  else {
+    Saturation::ProvingHelper::runVampire(*_prb, opt);
+  }
 
   //set return value to zero if we were successful
   if (env.statistics->terminationReason == Statistics::REFUTATION ||
@@ -631,6 +682,227 @@ void PortfolioMode::runSlice(Options& strategyOpt)
   exit(resultValue);
 } // runSlice
 
+/**
+ * Wait until the current process is reparented from @b parent
+ * and return true if it was adopted by @b adopter
+ */
+static bool waitForAdoption(pid_t parent, pid_t adopter)
+{
+  while (getppid() == parent) {
+    usleep(1000);
+  }
+  return getppid() == adopter;
+}
+
+/**
+ * Start a slice by forking a zygote that has already performed the
+ * preprocessing the slice needs and return its pid. If there is no such
+ * zygote yet, start the slice as its donor, i.e. it will create the
+ * zygote after its preprocessing. Return -1 if the slice is to be
+ * started by a plain fork.
+ *
+ * The zygotes and the slices forked from them are orphaned on purpose
+ * and get adopted by us, as we are registered as a child subreaper.
+ * That way they are waited for just as the slices we fork ourselves.
+ */
+pid_t PortfolioMode::spawnPrepared(vstring sliceCode, int remainingTime)
+{
+  CALL("PortfolioMode::spawnPrepared");
+
+  if (!_sharePreprocessing) {
+    return -1;
+  }
+
+  vstring key;
+  try {
+    Options opt = *env.options;
+    // the slice itself will warn about unknown values
+    opt.setIgnoreMissing(Options::IgnoreMissing::ON);
+    opt.readFromEncodedOptions(sliceCode);
+    opt.setNormalize(false);
+    opt.setForcedOptionValues();
+    key = opt.generateEncodedPreprocessingOptions();
+  }
+  catch (Exception&) {
+    // let the slice itself complain
+    return -1;
+  }
+
+  Zygote* zygote;
+  if (_zygotes.getValuePtr(key, zygote)) {
+    int sockets[2];
+    if (_zygotes.size() > env.options->sharedPreprocessing() ||
+        socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets)) {
+      _zygotes.remove(key);
+      return -1;
+    }
+    pid_t pid = Multiprocessing::instance()->fork();
+    ASS_NEQ(pid, -1);
+    if (pid) {
+      close(sockets[1]);
+      zygote->socket = sockets[0];
+      zygote->pid = 0;
+      return pid;
+    }
+    close(sockets[0]);
+    _donorSocket = sockets[1];
+    PortfolioSliceExecutor(this).runSlice(sliceCode, remainingTime);
+    ASSERTION_VIOLATION; // should not return
+  }
+
+  if (!zygote->pid) {
+    pid_t pid;
+    ssize_t res = recv(zygote->socket, &pid, sizeof(pid), MSG_DONTWAIT);
+    if (res == -1 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      // the donor is still preprocessing
+      return -1;
+    }
+    if (res != sizeof(pid)) {
+      // the donor did not make it through the preprocessing, the next slice will try again
+      close(zygote->socket);
+      _zygotes.remove(key);
+      return -1;
+    }
+    zygote->pid = pid;
+  }
+
+  static char request[65536];
+  if (sizeof(int) + sliceCode.size() > sizeof(request)) {
+    return -1;
+  }
+  memcpy(request, &remainingTime, sizeof(int));
+  memcpy(request + sizeof(int), sliceCode.data(), sliceCode.size());
+
+  pid_t slice = -1;
+  if (send(zygote->socket, request, sizeof(int) + sliceCode.size(), MSG_NOSIGNAL) != -1) {
+    pollfd pfd;
+    pfd.fd = zygote->socket;
+    pfd.events = POLLIN;
+    int ready;
+    do {
+      ready = poll(&pfd, 1, 5000);
+    } while (ready == -1 && errno == EINTR);
+    if (ready != 1 || recv(zygote->socket, &slice, sizeof(slice), 0) != sizeof(slice)) {
+      slice = -1;
+    }
+  }
+  if (slice == -1) {
+    // the zygote does not respond, get rid of it
+    Multiprocessing::instance()->killNoCheck(zygote->pid, SIGKILL);
+    close(zygote->socket);
+    _zygotes.remove(key);
+  }
+  return slice;
+} // spawnPrepared
+
+/**
+ * Called in a donor slice after its preprocessing: leave behind a copy of
+ * the current process to serve as a zygote for the other slices with
+ * the same preprocessing.
+ */
+void PortfolioMode::startZygote()
+{
+  CALL("PortfolioMode::startZygote");
+  ASS_NEQ(_donorSocket, -1);
+
+  pid_t helper = Multiprocessing::instance()->fork();
+  if (helper) {
+    close(_donorSocket);
+    _donorSocket = -1;
+    int resValue;
+    Multiprocessing::instance()->waitForParticularChildTermination(helper, resValue);
+    return;
+  }
+
+  helper = getpid();
+  if (Multiprocessing::instance()->fork()) {
+    _exit(0);
+  }
+  if (!waitForAdoption(helper, _portfolioPid)) {
+    _exit(0);
+  }
+  // die quietly with the portfolio process, but let the slices report as usual
+  void (*sighupHandler)(int) = signal(SIGHUP, SIG_DFL);
+  System::registerForSIGHUPOnParentDeath();
+  if (getppid() != _portfolioPid) {
+    // the portfolio process died before we registered
+    _exit(0);
+  }
+
+  Timer::setLimitEnforcement(false);
+  *env.options = *_portfolioOptions;
+  _prbPreprocessed = true;
+
+  pid_t self = getpid();
+  if (send(_donorSocket, &self, sizeof(self), MSG_NOSIGNAL) != sizeof(self)) {
+    _exit(0);
+  }
+  serveSlices(sighupHandler);
+} // startZygote
+
+/**
+ * The main loop of a zygote: fork a slice for every request received
+ * from the portfolio process and report its pid back
+ */
+void PortfolioMode::serveSlices(void (*sighupHandler)(int))
+{
+  CALL("PortfolioMode::serveSlices");
+
+  static char request[65536];
+  for (;;) {
+    ssize_t length = recv(_donorSocket, request, sizeof(request), 0);
+    if (length == -1 && errno == EINTR) {
+      continue;
+    }
+    if (length <= (ssize_t)sizeof(int)) {
+      // the portfolio process is gone or does not need us any more
+      _exit(0);
+    }
+    int remainingTime;
+    memcpy(&remainingTime, request, sizeof(int));
+    vstring sliceCode(request + sizeof(int), length - sizeof(int));
+
+    pid_t helper = Multiprocessing::instance()->fork();
+    if (!helper) {
+      helper = getpid();
+      pid_t slice = Multiprocessing::instance()->fork();
+      if (slice) {
+        send(_donorSocket, &slice, sizeof(slice), MSG_NOSIGNAL);
+        _exit(0);
+      }
+      close(_donorSocket);
+      _donorSocket = -1;
+      if (!waitForAdoption(helper, _portfolioPid)) {
+        _exit(1);
+      }
+      signal(SIGHUP, sighupHandler);
+      PortfolioSliceExecutor(this).runSlice(sliceCode, remainingTime);
+      ASSERTION_VIOLATION; // should not return
+    }
+    int resValue;
+    Multiprocessing::instance()->waitForParticularChildTermination(helper, resValue);
+  }
+} // serveSlices
+
+/**
+ * Terminate all zygotes
+ */
+void PortfolioMode::killZygotes()
+{
+  CALL("PortfolioMode::killZygotes");
+
+  VirtualIterator<Zygote> it = _zygotes.range();
+  while (it.hasNext()) {
+    Zygote zygote = it.next();
+    if (zygote.pid) {
+      Multiprocessing::instance()->killNoCheck(zygote.pid, SIGKILL);
+      waitpid(zygote.pid, 0, 0);
+    }
+    close(zygote.socket);
+  }
+  _zygotes.reset();
+} // killZygotes
+
 // BELOW ARE TWO LEFT-OVER FUNCTIONS FROM THE ORIGINAL (SINGLE-CHILD) CASC-MODE
 // THE CODE WAS KEPT FOR NOW AS IT DOESN'T DIRECTLY CORRESPOND TO ANYTHING ABOVE
 
@@ -17,6 +17,7 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
 #include "Lib/Portability.hpp"
 #include "Lib/ScopedPtr.hpp"
 #include "Lib/Set.hpp"
@@ -51,6 +52,7 @@ class PortfolioSliceExecutor : public SliceExecutor
 public:
   PortfolioSliceExecutor(PortfolioMode *mode);
   void runSlice(vstring sliceCode, int remainingTime) override;
+  pid_t spawnPrepared(vstring sliceCode, int remainingTime) override;
 
 private:
   PortfolioMode *_mode;
@@ -64,6 +66,7 @@ class PortfolioMode {
 
   PortfolioMode();
   friend void PortfolioSliceExecutor::runSlice(vstring sliceCode, int terminationTime);
+  friend pid_t PortfolioSliceExecutor::spawnPrepared(vstring sliceCode, int remainingTime);
 public:
   static bool perform(float slowness);
   unsigned getSliceTime(vstring sliceCode,vstring& chopped);
@@ -81,6 +84,11 @@ private:
   [[noreturn]] void runSlice(vstring slice, unsigned timeLimitInDeciseconds);
   [[noreturn]] void runSlice(Options& strategyOpt);
 
+  pid_t spawnPrepared(vstring sliceCode, int remainingTime);
+  void startZygote();
+  [[noreturn]] void serveSlices(void (*sighupHandler)(int));
+  void killZygotes();
+
 #if VDEBUG
   DHSet<pid_t> childIds;
 #endif
@@ -98,6 +106,28 @@ private:
   ScopedPtr<Problem> _prb;
 
   Semaphore _syncSemaphore; // semaphore for synchronizing proof printing
+
+  /**
+   * A process holding a preprocessed problem, from which slices that
+   * share the preprocessing are forked (see the shared_preprocessing option)
+   */
+  struct Zygote {
+    int socket; // our end of the socket pair connected to the zygote
+    pid_t pid;  // zero until the zygote reports itself ready
+  };
+  /** Zygotes indexed by Options::generateEncodedPreprocessingOptions() */
+  DHMap<vstring,Zygote> _zygotes;
+  bool _sharePreprocessing;
+  pid_t _portfolioPid;
+
+  // the following are only used in the children
+
+  /** socket on which a slice reports the zygote created after its preprocessing, or -1 */
+  int _donorSocket;
+  /** true if _prb has already been preprocessed */
+  bool _prbPreprocessed;
+  /** options of the portfolio process, to be restored in the zygote */
+  ScopedPtr<Options> _portfolioOptions;
 };
 
 }
@@ -16,6 +16,7 @@
 #include "Lib/System.hpp"
 #include "Lib/Sys/Multiprocessing.hpp"
 #include "Lib/Timer.hpp"
+#include "Saturation/SliceProgress.hpp"
 #include "Shell/Options.hpp"
 #include "Shell/UIHelper.hpp"
 
@@ -28,7 +29,7 @@ using namespace Lib::Sys;
 #define DECI(milli) (milli/100)
 
 ScheduleExecutor::ScheduleExecutor(ProcessPriorityPolicy *policy, SliceExecutor *executor)
-  : _policy(policy), _executor(executor)
+  : _policy(policy), _executor(executor), _savedTime(0)
 {
   CALL("ScheduleExecutor::ScheduleExecutor");
   _numWorkers = getNumWorkers();
@@ -79,6 +80,8 @@ bool ScheduleExecutor::run(const Schedule &schedule)
   typedef List<pid_t> Pool;
   Pool *pool = Pool::empty();
 
+  Saturation::SliceProgress* progress = Saturation::SliceProgress::instance();
+
   bool success = false;
   int remainingTime;
   while(Timer::syncClock(), remainingTime = DECI(env.remainingTime()), remainingTime > 0)
@@ -106,9 +109,16 @@ bool ScheduleExecutor::run(const Schedule &schedule)
 
     bool stopped, exited, signalled;
     int code;
-    // sleep until process changes state
+    // sleep until process changes state, or look at the progress of
+    // the slices every now and then if they report it
     pid_t process = Multiprocessing::instance()
-      ->poll_children(stopped, exited, signalled, code);
+      ->poll_children(stopped, exited, signalled, code, !progress);
+    if(!process)
+    {
+      adaptSliceTimes(pool, queue.isEmpty(), remainingTime);
+      Multiprocessing::instance()->sleep(100);
+      continue;
+    }
 
     /*
     cout << "Child " << process
@@ -117,6 +127,18 @@ bool ScheduleExecutor::run(const Schedule &schedule)
         << " sig " << signalled << " code " << code << endl;
         */
 
+    // not one of the slices (e.g. a process adopted from a slice)
+    if(!Pool::member(process, pool))
+    {
+      continue;
+    }
+
+    if(progress && (exited || signalled))
+    {
+      progress->release(process);
+      _history.remove(process);
+    }
+
     // child died, remove it from the pool and check if succeeded
     if(exited)
     {
@@ -160,6 +182,101 @@ exit:
   return success;
 }
 
+/**
+ * Change the time limits of the running slices according to their progress
+ * (see the adaptive_slices option).
+ *
+ * The progress of a slice is the number of clauses it activates. Once a slice
+ * has used half of its time and discards clauses because of LRS limits, it is
+ * stopped if it activated clauses eight times slower recently than on average.
+ * The time it leaves unused is saved for slices that are still making progress
+ * close to their limit: such a slice gets up to half of its limit once more,
+ * as far as the saved time allows. When no slices wait for a worker, nobody
+ * else can use the time and stalled slices keep running, while slices making
+ * progress get the extension regardless of the saved time.
+ */
+void ScheduleExecutor::adaptSliceTimes(List<pid_t>* pool, bool queueEmpty, int remainingTime)
+{
+  CALL("ScheduleExecutor::adaptSliceTimes");
+
+  List<pid_t>::Iterator it(pool);
+  while(it.hasNext())
+  {
+    pid_t process = it.next();
+    Saturation::SliceProgress::Report* r = Saturation::SliceProgress::instance()->find(process);
+    if(!r || !r->time || !r->timeLimit)
+    {
+      continue;
+    }
+    int time = r->time;
+    unsigned activations = r->activations;
+    int limit = r->timeLimit;
+
+    SliceHistory* h;
+    if(_history.getValuePtr(process, h))
+    {
+      h->time = time;
+      h->activations = activations;
+      h->extended = false;
+      continue;
+    }
+    // compare the rates over windows of at least a second, except when the
+    // slice is about to reach its limit and must be extended now or never
+    int window = time - h->time;
+    if(!window || (window < 10 && 10*time < 9*limit))
+    {
+      continue;
+    }
+    // the recent and the average rate of activations, scaled by the
+    // product of the two durations
+    unsigned long long recent = (unsigned long long)(activations - h->activations) * time;
+    unsigned long long average = (unsigned long long)activations * window;
+    if(window >= 10)
+    {
+      h->time = time;
+      h->activations = activations;
+    }
+
+    if(!queueEmpty && 2*time >= limit && r->limited && recent*8 < average)
+    {
+      r->timeLimit = time;
+      _savedTime += limit - time;
+      if(Shell::outputAllowed())
+      {
+        env.beginOutput();
+        Shell::addCommentSignForSZS(env.out());
+        env.out() << "Stopping stalled slice " << process << " at " << time << " of " << limit << " ds" << endl;
+        env.endOutput();
+      }
+    }
+    else if(!h->extended && 10*time >= 9*limit && !r->limited && 2*recent >= average)
+    {
+      int extension = min(limit / 2, remainingTime - (limit - time));
+      if(!queueEmpty)
+      {
+        extension = min(extension, _savedTime);
+      }
+      if(extension <= 0)
+      {
+        continue;
+      }
+      r->timeLimit = limit + extension;
+      h->extended = true;
+      if(!queueEmpty)
+      {
+        _savedTime -= extension;
+      }
+      if(Shell::outputAllowed())
+      {
+        env.beginOutput();
+        Shell::addCommentSignForSZS(env.out());
+        env.out() << "Extending slice " << process << " from " << limit << " to " << limit + extension << " ds" << endl;
+        env.endOutput();
+      }
+    }
+  }
+}
+
 unsigned ScheduleExecutor::getNumWorkers()
 {
   CALL("ScheduleExecutor::getNumWorkers");
@@ -178,6 +295,12 @@ pid_t ScheduleExecutor::spawn(vstring code, int remainingTime)
 {
   CALL("ScheduleExecutor::spawn");
 
+  pid_t prepared = _executor->spawnPrepared(code, remainingTime);
+  if(prepared != -1)
+  {
+    return prepared;
+  }
+
   pid_t pid = Multiprocessing::instance()->fork();
   ASS_NEQ(pid, -1);
 
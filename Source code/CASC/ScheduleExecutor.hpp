@@ -11,6 +11,8 @@
 #define __ScheduleExecutor__
 
 #include <unistd.h>
+#include "Lib/DHMap.hpp"
+#include "Lib/List.hpp"
 #include "Schedules.hpp"
 
 namespace CASC
@@ -27,6 +29,12 @@ class SliceExecutor
 {
 public:
   [[noreturn]] virtual void runSlice(Lib::vstring sliceCode, int remaminingTime) = 0;
+  /**
+   * Try to start the slice in a process that is not a fresh fork of the
+   * current one (which must nevertheless be waitable by it).
+   * Return -1 if the slice should be started by forking as usual.
+   */
+  virtual pid_t spawnPrepared(Lib::vstring sliceCode, int remainingTime) { return -1; }
 };
 
 class ScheduleExecutor
@@ -38,10 +46,22 @@ public:
 private:
   pid_t spawn(Lib::vstring code, int remaminingTime);
   unsigned getNumWorkers();
+  void adaptSliceTimes(Lib::List<pid_t>* pool, bool queueEmpty, int remainingTime);
+
+  /** Progress of a running slice when it was last considered by adaptSliceTimes */
+  struct SliceHistory
+  {
+    int time;
+    unsigned activations;
+    bool extended;
+  };
 
   ProcessPriorityPolicy *_policy;
   SliceExecutor *_executor;
   unsigned _numWorkers;
+  Lib::DHMap<pid_t, SliceHistory> _history;
+  /** deciseconds taken from stalled slices and not yet given to other slices */
+  int _savedTime;
 };
 }
 
@@ -14,6 +14,10 @@
  * @author Martin Suda
  */
 
+#include <fstream>
+
+#include "Lib/Int.hpp"
+
 #include "Schedules.hpp"
 
 using namespace Lib;
@@ -3096,3 +3100,102 @@ void Schedules::getStructInductionSchedule(const Shell::Property& property, Sche
 
   fallback.push("lrs+10_1__50");
 }
+
+/**
+ * Return true if the condition @b cond of a schedule file holds for @b property.
+ * Set @b valid to false if @b cond is not a condition.
+ *
+ * The conditions are
+ * <ul>
+ *  <li>cat=C where C is a category such as FNE or HEQ;</li>
+ *  <li>props=N requiring property.props() to equal N;</li>
+ *  <li>props&N requiring property.props() to share a bit with N;</li>
+ *  <li>props!&N requiring property.props() to share no bit with N;</li>
+ *  <li>atoms<N and atoms>N comparing the number of atoms with N.</li>
+ * </ul>
+ */
+static bool scheduleConditionHolds(const vstring& cond, const Property& property, bool& valid)
+{
+  CALL("scheduleConditionHolds");
+
+  valid = true;
+  unsigned long prop = property.props();
+  long long unsigned num;
+  if (cond.substr(0,4) == "cat=") {
+    return property.categoryString() == cond.substr(4);
+  }
+  if (cond.substr(0,6) == "props=" && Int::stringToUnsigned64(cond.substr(6),num)) {
+    return prop == num;
+  }
+  if (cond.substr(0,6) == "props&" && Int::stringToUnsigned64(cond.substr(6),num)) {
+    return prop & num;
+  }
+  if (cond.substr(0,7) == "props!&" && Int::stringToUnsigned64(cond.substr(7),num)) {
+    return !(prop & num);
+  }
+  if (cond.substr(0,6) == "atoms<" && Int::stringToUnsigned64(cond.substr(6),num)) {
+    return static_cast<long long unsigned>(property.atoms()) < num;
+  }
+  if (cond.substr(0,6) == "atoms>" && Int::stringToUnsigned64(cond.substr(6),num)) {
+    return static_cast<long long unsigned>(property.atoms()) > num;
+  }
+  valid = false;
+  return false;
+}
+
+/**
+ * Get schedules for a problem of given property from the file @b fileName.
+ *
+ * Each line of the file that is neither empty nor a comment starting with %
+ * consists of words separated by white space. The first word is quick or
+ * fallback and tells the schedule to which the line belongs, the last word
+ * is a slice (a strategy followed by its time limit in deciseconds) and the
+ * words in between are conditions (see scheduleConditionHolds). A slice is
+ * added to its schedule if all the conditions hold, in the order of the file.
+ */
+void Schedules::getScheduleFromFile(const vstring& fileName, const Property& property, Schedule& quick, Schedule& fallback)
+{
+  CALL("Schedules::getScheduleFromFile");
+
+  BYPASSING_ALLOCATOR;
+
+  ifstream in(fileName.c_str());
+  if (in.fail()) {
+    USER_ERROR("Cannot open schedule file: "+fileName);
+  }
+
+  vstring line;
+  unsigned lineNumber = 0;
+  while (getline(in, line)) {
+    lineNumber++;
+    vistringstream words(line);
+    vstring word;
+    Stack<vstring> parts;
+    while (words >> word) {
+      parts.push(word);
+    }
+    if (parts.isEmpty() || parts[0][0] == '%') {
+      continue;
+    }
+    if (parts.size() < 2 || (parts[0] != "quick" && parts[0] != "fallback")) {
+      USER_ERROR("Schedule file "+fileName+", line "+Int::toString(lineNumber)+": expected quick or fallback followed by a slice");
+    }
+    bool holds = true;
+    for (unsigned i = 1; i+1 < parts.size(); i++) {
+      bool valid;
+      holds &= scheduleConditionHolds(parts[i], property, valid);
+      if (!valid) {
+        USER_ERROR("Schedule file "+fileName+", line "+Int::toString(lineNumber)+": unknown condition "+parts[i]);
+      }
+    }
+    const vstring& slice = parts.top();
+    size_t pos = slice.find_last_of('_');
+    unsigned time;
+    if (pos == vstring::npos || !Int::stringToUnsignedInt(slice.substr(pos+1), time)) {
+      USER_ERROR("Schedule file "+fileName+", line "+Int::toString(lineNumber)+": slice "+slice+" does not end with _ and a time limit");
+    }
+    if (holds) {
+      (parts[0] == "quick" ? quick : fallback).push(slice);
+    }
+  }
+} // getScheduleFromFile
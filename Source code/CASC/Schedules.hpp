@@ -41,6 +41,8 @@ public:
   static void getInductionSchedule(const Shell::Property& property, Schedule& quick, Schedule& fallback);
   static void getIntegerInductionSchedule(const Shell::Property& property, Schedule& quick, Schedule& fallback);
   static void getStructInductionSchedule(const Shell::Property& property, Schedule& quick, Schedule& fallback);
+
+  static void getScheduleFromFile(const Lib::vstring& fileName, const Shell::Property& property, Schedule& quick, Schedule& fallback);
 };
 
 }
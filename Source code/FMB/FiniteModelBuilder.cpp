@@ -30,6 +30,7 @@
 #include "Kernel/Substitution.hpp"
 #include "Kernel/FormulaUnit.hpp"
 
+#include "SAT/CDCLSolver.hpp"
 #include "SAT/MinisatInterfacingNewSimp.hpp"
 #include "SAT/BufferedSolver.hpp"
 
@@ -143,6 +144,8 @@ FiniteModelBuilder::FiniteModelBuilder(Problem& prb, const Options& opt)
     default:
       ASSERTION_VIOLATION;
   }
+
+  _incremental = opt.fmbIncremental();
 }
 
 FiniteModelBuilder::~FiniteModelBuilder()
@@ -162,6 +165,104 @@ FiniteModelBuilder::~FiniteModelBuilder()
 bool FiniteModelBuilder::reset(){
   CALL("FiniteModelBuilder::reset");
 
+  if(_incremental && _solver && extend()){
+    return true;
+  }
+
+  _distinctSortCapacities.ensure(_distinctSortSizes.size());
+  for(unsigned i=0;i<_distinctSortSizes.size();i++){
+    _distinctSortCapacities[i] = _distinctSortSizes[i];
+  }
+  if(!layoutVariables()){
+    return false;
+  }
+  if(_incremental){
+    // Leave room for larger sizes so that the SAT solver (and the clauses added to it)
+    // can be kept for the next few sizes. With symbols of a large arity the room is
+    // expensive, so it is halved until the layout needs at most twice the variables
+    unsigned exactVars = _nextVar;
+    for(unsigned shift=0;;shift++){
+      bool room = false;
+      for(unsigned i=0;i<_distinctSortSizes.size();i++){
+        unsigned size = _distinctSortSizes[i];
+        _distinctSortCapacities[i] = max(size,min(size+(size>>shift),_distinctSortMaxs[i]));
+        room |= _distinctSortCapacities[i] > size;
+      }
+      if(!room){
+        ALWAYS(layoutVariables());
+        break;
+      }
+      if(layoutVariables() && _nextVar/2 <= exactVars){
+        break;
+      }
+    }
+  }
+
+  // Release the old SAT solver before creating a new one
+  _solver = 0;
+  // Create a new SAT solver
+  if(_opt.satSolver() == Options::SatSolver::CDCL){
+    _solver = new CDCLSolver(_opt,true);
+  } else {
+    try{
+      MinisatInterfacingNewSimp* minisat = new MinisatInterfacingNewSimp(_opt,true);
+      if(_incremental){
+        // clauses added in later rounds may use any variable, so none can be eliminated
+        minisat->disableSimplification();
+      }
+      _solver = minisat;
+    }catch(Minisat::OutOfMemoryException&){
+      MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
+    }
+  }
+
+  /*
+  if(_opt.satSolver() != Options::SatSolver::MINISAT){
+    cout << "Warning: overriding sat solver for FMB, using minisat" << endl;
+  }
+  */
+/*
+  switch(_opt.satSolver()){
+#if VZ3
+    case Options::SatSolver::Z3:
+        ASSERTION_VIOLATION_REP("Do not use fmb with Z3");
+#endif
+    case Options::SatSolver::MINISAT:
+        try{
+          _solver = new MinisatInterfacingNewSimp(_opt,true);
+        }catch(Minisat::OutOfMemoryException&){
+          MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
+        }
+      break;
+    default:
+      ASSERTION_VIOLATION_REP(_opt.satSolver());
+  }
+*/
+
+  // set the number of SAT variables, this could cause an exception
+  _solver->ensureVarCount(_nextVar-1);
+
+  // nothing has been added to the new solver yet
+  _groundedDistinctSortSizes.init(_distinctSortSizes.size(),0);
+  _groundClausesAdded = false;
+  _solverClauseCount = 0;
+  _symmetryMarker = 0;
+  if(_incremental && !newRoundMarkers()){
+    return false;
+  }
+
+  // needs to be redone for each size as we use this to pick the number of
+  // things to order and the constants to ground with 
+  createSymmetryOrdering();
+
+  return true;
+}
+
+// Assign SAT variables to the groundings of symbols and to the markers using _distinctSortCapacities
+// Returns false if we run out of SAT variables
+bool FiniteModelBuilder::layoutVariables(){
+  CALL("FiniteModelBuilder::layoutVariables");
+
   // Construct the offsets for symbols
   // Each symbol requires size^n) variables where n is the number of spaces for grounding
   // For function symbols we have n=arity+1 as we have the return value
@@ -170,9 +271,15 @@ bool FiniteModelBuilder::reset(){
 
   // This has been refined after adding multiple sorts i.e. no general 'size'
   // We now need the current size of the sort of each position to compute the offsets
+  // The sizes used are the capacities, which are at least the current sizes
 
   static const unsigned VAR_MAX = MinisatInterfacingNewSimp::VAR_MAX;
 
+  _sortCapacities.ensure(_sortedSignature->sorts);
+  for(unsigned s=0;s<_sortedSignature->sorts;s++){
+    _sortCapacities[s] = _distinctSortCapacities[_sortedSignature->parents[s]];
+  }
+
   // Start from 1 as SAT solver variables are 1-based
   unsigned offsets=1;
   for(unsigned f=0; f<env.signature->functions();f++){
@@ -185,9 +292,9 @@ bool FiniteModelBuilder::reset(){
     DArray<unsigned> f_signature = _sortedSignature->functionSignatures[f];
     ASS(f_signature.size() == env.signature->functionArity(f)+1);
 
-    unsigned add = _sortModelSizes[f_signature[0]]; 
+    unsigned add = _sortCapacities[f_signature[0]]; 
     for(unsigned i=1;i<f_signature.size();i++){
-      unsigned n_add = add * _sortModelSizes[f_signature[i]];
+      unsigned n_add = add * _sortCapacities[f_signature[i]];
       if (n_add < add) { // additional overflow check - we multiply by positive integers!
         return false;
       }
@@ -213,7 +320,7 @@ bool FiniteModelBuilder::reset(){
     ASS(p_signature.size()==env.signature->predicateArity(p));
     unsigned add=1;
     for(unsigned i=0;i<p_signature.size();i++){
-      unsigned n_add = add * _sortModelSizes[p_signature[i]];
+      unsigned n_add = add * _sortCapacities[p_signature[i]];
       if (n_add < add) { // additional overflow check - we multiply by positive integers!
         return false;
       }
@@ -234,7 +341,7 @@ bool FiniteModelBuilder::reset(){
   if (_xmass) {
     marker_offsets.ensure(_distinctSortSizes.size());
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-      unsigned add = _distinctSortSizes[i];
+      unsigned add = _distinctSortCapacities[i];
 
       marker_offsets[i] = offsets;
 
@@ -248,14 +355,17 @@ bool FiniteModelBuilder::reset(){
   } else {
     unsigned add = _distinctSortSizes.size();
 
-    totalityMarker_offset = offsets;
+    // in incremental mode these are new for each round, see newRoundMarkers
+    if (!_incremental) {
+      totalityMarker_offset = offsets;
 
-    // Check for overflow
-    if(VAR_MAX - add < offsets){
-      return false;
-    }
+      // Check for overflow
+      if(VAR_MAX - add < offsets){
+        return false;
+      }
 
-    offsets += add;
+      offsets += add;
+    }
 
     instancesMarker_offset = offsets;
 
@@ -267,46 +377,66 @@ bool FiniteModelBuilder::reset(){
     offsets += add;
   }
 
-  // Create a new SAT solver
-  try{
-    _solver = new MinisatInterfacingNewSimp(_opt,true);
-  }catch(Minisat::OutOfMemoryException&){
-    MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
-  }
+  _nextVar = offsets;
+  return true;
+}
 
-  /*
-  if(_opt.satSolver() != Options::SatSolver::MINISAT){
-    cout << "Warning: overriding sat solver for FMB, using minisat" << endl;
+// Move on to the current sizes keeping the SAT solver and the clauses added to it so far
+// This is possible if no sort shrinks and the variables were laid out for the current sizes,
+// otherwise we return false and the caller starts from scratch
+bool FiniteModelBuilder::extend(){
+  CALL("FiniteModelBuilder::extend");
+  ASS(_incremental);
+
+  for(unsigned i=0;i<_distinctSortSizes.size();i++){
+    if(_distinctSortSizes[i] < _groundedDistinctSortSizes[i] ||
+       _distinctSortSizes[i] > _distinctSortCapacities[i]){
+      return false;
+    }
   }
-  */
-/*
-  switch(_opt.satSolver()){
-#if VZ3
-    case Options::SatSolver::Z3:
-        ASSERTION_VIOLATION_REP("Do not use fmb with Z3");
-#endif
-    case Options::SatSolver::MINISAT:
-        try{
-          _solver = new MinisatInterfacingNewSimp(_opt,true);
-        }catch(Minisat::OutOfMemoryException&){
-          MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
-        }
-      break;
-    default:
-      ASSERTION_VIOLATION_REP(_opt.satSolver());
+  if(!newRoundMarkers()){
+    return false;
   }
-*/
 
-  // set the number of SAT variables, this could cause an exception
-  _solver->ensureVarCount(offsets-1);
-
-  // needs to be redone for each size as we use this to pick the number of
-  // things to order and the constants to ground with 
   createSymmetryOrdering();
 
   return true;
 }
 
+// Allocate fresh markers for the clauses which only hold for the current sizes
+// Old markers are not assumed any more, which switches such clauses from previous rounds off
+bool FiniteModelBuilder::newRoundMarkers(){
+  CALL("FiniteModelBuilder::newRoundMarkers");
+  ASS(_incremental);
+
+  unsigned add = _xmass ? 1 : 1+_distinctSortSizes.size();
+  if(MinisatInterfacingNewSimp::VAR_MAX - add < _nextVar){
+    return false;
+  }
+
+  // fix the old markers to false, the clauses they guard are then satisfied
+  // and the SAT solver can drop them when it simplifies
+  if(_symmetryMarker){
+    static SATLiteralStack satClauseLits;
+    satClauseLits.reset();
+    satClauseLits.push(SATLiteral(_symmetryMarker,0));
+    addSATClause(SATClause::fromStack(satClauseLits));
+    for(unsigned i=0;!_xmass && i<_distinctSortSizes.size();i++){
+      satClauseLits.reset();
+      satClauseLits.push(SATLiteral(totalityMarker_offset+i,0));
+      addSATClause(SATClause::fromStack(satClauseLits));
+    }
+  }
+
+  _symmetryMarker = _nextVar++;
+  if(!_xmass){
+    totalityMarker_offset = _nextVar;
+    _nextVar += _distinctSortSizes.size();
+  }
+  _solver->ensureVarCount(_nextVar-1);
+  return true;
+}
+
 // Compare function symbols by their usage in the problem
 struct FMBSymmetryFunctionComparator
 {
@@ -955,8 +1085,9 @@ void FiniteModelBuilder::addGroundClauses()
 {
   CALL("FiniteModelBuilder::addGroundClauses");
 
-  // If we don't have any ground clauses don't do anything
-  if(!_groundClauses) return;
+  // If we don't have any ground clauses (or they are already in the solver) don't do anything
+  if(!_groundClauses || _groundClausesAdded) return;
+  _groundClausesAdded = true;
 
   ClauseList::Iterator cit(_groundClauses);
 
@@ -1006,9 +1137,140 @@ unsigned FiniteModelBuilder::estimateInstanceCount()
   return res;
 }
 
+/**
+ * Iterates over the groundings with 1 <= grounding[i] <= maxs[i] such that
+ * grounding[i] > oldMaxs[i] for some i, i.e. over those which were not
+ * used for the sizes oldMaxs. The groundings are grouped by the first
+ * position exceeding oldMaxs and ordered lexicographically within the
+ * groups, so for oldMaxs all zero this is the usual lexicographic order.
+ */
+class NewGroundingIterator
+{
+public:
+  NewGroundingIterator(const DArray<unsigned>& maxs, const DArray<unsigned>& oldMaxs, unsigned len)
+  : _maxs(maxs), _oldMaxs(oldMaxs), _len(len), _pivot(0), _started(false),
+    _mins(len), _tops(len), _grounding(len) {}
+
+  const DArray<unsigned>& grounding() const { return _grounding; }
+
+  /** Move to the next grounding, return false if there is none */
+  bool next()
+  {
+    CALL("NewGroundingIterator::next");
+
+    if(_started && advance()){
+      return true;
+    }
+    _started = true;
+    while(_pivot < _len){
+      if(startGroup(_pivot++)){
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  /** Set up the groundings whose first position exceeding oldMaxs is p */
+  bool startGroup(unsigned p)
+  {
+    for(unsigned i=0;i<_len;i++){
+      unsigned lo = 1;
+      unsigned hi = _maxs[i];
+      if(i < p){
+        hi = min(hi,_oldMaxs[i]);
+      } else if(i == p){
+        lo = _oldMaxs[i]+1;
+      }
+      if(lo > hi){
+        return false;
+      }
+      _mins[i] = lo;
+      _tops[i] = hi;
+      _grounding[i] = lo;
+    }
+    return true;
+  }
+
+  bool advance()
+  {
+    for(unsigned i=_len;i>0;i--){
+      unsigned var = i-1;
+      if(_grounding[var] < _tops[var]){
+        _grounding[var]++;
+        return true;
+      }
+      _grounding[var] = _mins[var];
+    }
+    return false;
+  }
+
+  const DArray<unsigned>& _maxs;
+  const DArray<unsigned>& _oldMaxs;
+  unsigned _len;
+  unsigned _pivot;
+  bool _started;
+  DArray<unsigned> _mins;
+  DArray<unsigned> _tops;
+  DArray<unsigned> _grounding;
+};
+
+// Saves looking up symbols and their signatures for every instance of c
+void FiniteModelBuilder::compileForGrounding(Clause* c, Stack<GroundingLiteral>& lits,
+                                             Stack<pair<unsigned,unsigned>>& args)
+{
+  CALL("FiniteModelBuilder::compileForGrounding");
+
+  lits.reset();
+  args.reset();
+  for(unsigned lindex=0;lindex<c->length();lindex++){
+    Literal* lit = (*c)[lindex];
+    GroundingLiteral gl;
+    gl.base = 0;
+    gl.polarity = lit->polarity();
+    gl.twoVarEquality = lit->isTwoVarEquality();
+    gl.firstArg = args.size();
+
+    if(gl.twoVarEquality){
+      args.push(make_pair(lit->nthArgument(0)->var(),0u));
+      args.push(make_pair(lit->nthArgument(1)->var(),0u));
+    }
+    else{
+      // the arguments (and the result for a function) in the order used by getSATLiteral
+      Term* t;
+      bool isFunction = lit->isEquality();
+      if(isFunction){
+        ASS(lit->nthArgument(0)->isTerm());
+        ASS(lit->nthArgument(1)->isVar());
+        t = lit->nthArgument(0)->term();
+        gl.base = f_offsets[t->functor()];
+      }else{
+        t = lit;
+        gl.base = p_offsets[lit->functor()];
+      }
+      const DArray<unsigned>& signature = isFunction ?
+             _sortedSignature->functionSignatures[t->functor()] :
+             _sortedSignature->predicateSignatures[t->functor()];
+
+      unsigned mult=1;
+      for(unsigned j=0;j<t->arity();j++){
+        ASS(t->nthArgument(j)->isVar());
+        args.push(make_pair(t->nthArgument(j)->var(),mult));
+        mult *= _sortCapacities[signature[j]];
+      }
+      if(isFunction){
+        args.push(make_pair(lit->nthArgument(1)->var(),mult));
+      }
+    }
+    gl.argCnt = args.size()-gl.firstArg;
+    lits.push(gl);
+  }
+}
+
 void FiniteModelBuilder::addNewInstances()
 {
   CALL("FiniteModelBuilder::addNewInstances");
+  TimeCounter tc(TC_FMB_INSTANCE_GENERATION);
 
   ClauseList::Iterator cit(_clauses); 
 
@@ -1023,6 +1285,8 @@ void FiniteModelBuilder::addNewInstances()
     const DArray<unsigned>* varSorts = _clauseVariableSorts.get(c) ;
     static DArray<unsigned> maxVarSize;
     maxVarSize.ensure(vars);
+    static DArray<unsigned> oldVarSize;
+    oldVarSize.ensure(vars);
 
     if(!varSorts){
       // this means that the clause consists only of variable equalities
@@ -1046,6 +1310,7 @@ void FiniteModelBuilder::addNewInstances()
       //cout << "srt="<<srt;
       maxVarSize[var] = min(_sortModelSizes[srt],_sortedSignature->sortBounds[srt]);
       //cout << ",max="<<maxVarSize[var] << endl;
+      oldVarSize[var] = groundedSortSize(srt);
 
       if (!_xmass) {
         unsigned dsort = _sortedSignature->parents[srt];
@@ -1055,118 +1320,86 @@ void FiniteModelBuilder::addNewInstances()
       }
     }
     
-    static DArray<unsigned> grounding;
-    grounding.ensure(vars);
+    static Stack<GroundingLiteral> glits;
+    static Stack<pair<unsigned,unsigned>> gargs;
+    compileForGrounding(c,glits,gargs);
 
-    for(unsigned i=0;i<vars;i++) grounding[i]=1;
-    grounding[vars-1]=0;
+    // only the instances not added for the previous sizes
+    NewGroundingIterator git(maxVarSize,oldVarSize,vars);
+    const DArray<unsigned>& grounding = git.grounding();
 
 instanceLabel:
-    for(unsigned var=vars-1;var+1!=0;var--){
-     
-      //Checking against mins skips instances where sort size restricts it
-      if(grounding[var]==maxVarSize[var]){
-        grounding[var]=1;
-      } 
-      else{
-        grounding[var]++;
-        // Grounding represents a new instance
-        static SATLiteralStack satClauseLits;
-        satClauseLits.reset();
-
-        if (_xmass) {
-          varDistinctSortsMaxes.reset();
-          for(unsigned var=0;var<vars;var++) {
-            // cout << " var" << var;
-            unsigned srt = (*varSorts)[var];
-            // cout << " srt" << srt;
-            unsigned dsr = _sortedSignature->parents[srt];
-            // cout << " dsr" << dsr;
-
-            if (_sortedSignature->monotonicSorts[dsr]) {
-              continue;
-            }
-
-            unsigned prev = varDistinctSortsMaxes.get(dsr,0);
-            // cout << " prev" << prev;
+    while(git.next()){
+      // Grounding represents a new instance
+      static SATLiteralStack satClauseLits;
+      satClauseLits.reset();
 
-            unsigned cur = grounding[var];
-            // cout << " cur" << cur;
+      if (_xmass) {
+        varDistinctSortsMaxes.reset();
+        for(unsigned var=0;var<vars;var++) {
+          // cout << " var" << var;
+          unsigned srt = (*varSorts)[var];
+          // cout << " srt" << srt;
+          unsigned dsr = _sortedSignature->parents[srt];
+          // cout << " dsr" << dsr;
+
+          if (_sortedSignature->monotonicSorts[dsr]) {
+            continue;
+          }
 
-            varDistinctSortsMaxes.set(dsr,max(cur,prev));
+          unsigned prev = varDistinctSortsMaxes.get(dsr,0);
+          // cout << " prev" << prev;
 
-            // cout << endl;
-          }
+          unsigned cur = grounding[var];
+          // cout << " cur" << cur;
 
-          // start by adding the sort markers
-          for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-            unsigned val = varDistinctSortsMaxes.get(i,0);
+          varDistinctSortsMaxes.set(dsr,max(cur,prev));
 
-            if (val > 1) {
-              // cout << "Marking sort " << i << " with " << val-2 << " negative" << endl;
-              satClauseLits.push(SATLiteral(marker_offsets[i]+val-2,0));
-            }
-          }
-          // cout << "Clause finised" << endl;
-        } else {
-          for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-            if (varDistinctSortsMaxes.get(i,0)) {
-              satClauseLits.push(SATLiteral(instancesMarker_offset+i,0));
-            }
-          }
+          // cout << endl;
         }
 
-        // Ground and translate each literal into a SATLiteral
-        for(unsigned lindex=0;lindex<c->length();lindex++){
-          Literal* lit = (*c)[lindex];
+        // start by adding the sort markers
+        for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+          unsigned val = varDistinctSortsMaxes.get(i,0);
 
-          // check cases where literal is x=y
-          if(lit->isTwoVarEquality()){
-            bool equal = grounding[lit->nthArgument(0)->var()] == grounding[lit->nthArgument(1)->var()]; 
-            if((lit->isPositive() && equal) || (!lit->isPositive() && !equal)){
-              //Skip instance
-              goto instanceLabel; 
-            } 
-            if((lit->isPositive() && !equal) || (!lit->isPositive() && equal)){
-              //Skip literal
-              continue;
-            }
+          if (val > 1) {
+            // cout << "Marking sort " << i << " with " << val-2 << " negative" << endl;
+            satClauseLits.push(SATLiteral(marker_offsets[i]+val-2,0));
           }
-          if(lit->isEquality()){
-            ASS(lit->nthArgument(0)->isTerm());
-            ASS(lit->nthArgument(1)->isVar());
-            Term* t = lit->nthArgument(0)->term();
-            unsigned functor = t->functor();
-            unsigned arity = t->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity+1);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(t->nthArgument(j)->isVar());
-              use[j] = grounding[t->nthArgument(j)->var()];
-            }
-            use[arity]=grounding[lit->nthArgument(1)->var()];
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),true));
-            
-          }else{
-            unsigned functor = lit->functor();
-            unsigned arity = lit->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(lit->nthArgument(j)->isVar());
-              use[j] = grounding[lit->nthArgument(j)->var()];
-            }
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),false));
+        }
+        // cout << "Clause finised" << endl;
+      } else {
+        for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+          if (varDistinctSortsMaxes.get(i,0)) {
+            satClauseLits.push(SATLiteral(instancesMarker_offset+i,0));
           }
         }
-     
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+      }
 
-        goto instanceLabel;
+      // Ground and translate each literal into a SATLiteral
+      for(unsigned lindex=0;lindex<glits.size();lindex++){
+        const GroundingLiteral& gl = glits[lindex];
+        const pair<unsigned,unsigned>* arg = gargs.begin()+gl.firstArg;
+
+        // check cases where literal is x=y
+        if(gl.twoVarEquality){
+          bool equal = grounding[arg[0].first] == grounding[arg[1].first];
+          if(gl.polarity == equal){
+            //Skip instance
+            goto instanceLabel; 
+          } 
+          //Skip literal
+          continue;
+        }
+        unsigned var = gl.base;
+        for(unsigned j=0;j<gl.argCnt;j++){
+          var += arg[j].second*(grounding[arg[j].first]-1);
+        }
+        satClauseLits.push(SATLiteral(var,gl.polarity));
       }
+   
+      SATClause* satCl = SATClause::fromStack(satClauseLits);
+      addSATClause(satCl);
     }
   }
 }
@@ -1220,60 +1453,55 @@ void FiniteModelBuilder::addNewFunctionalDefs()
     const DArray<unsigned>& f_signature = _sortedSignature->functionSignatures[f];
     static DArray<unsigned> maxVarSize;
     maxVarSize.ensure(arity+2);
+    static DArray<unsigned> oldVarSize;
+    oldVarSize.ensure(arity+2);
 
     // find max size of y and z 
     unsigned returnSrt = f_signature[arity];
     maxVarSize[0] = min(_sortedSignature->sortBounds[returnSrt],_sortModelSizes[returnSrt]);
     maxVarSize[1] = min(_sortedSignature->sortBounds[returnSrt],_sortModelSizes[returnSrt]);
+    oldVarSize[0] = groundedSortSize(returnSrt);
+    oldVarSize[1] = groundedSortSize(returnSrt);
 
     // we skip 0 and 1 as these are y and z
     for(unsigned var=2;var<arity+2;var++){
       unsigned srt = f_signature[var-2]; // f_signature[arity] is return sort
       maxVarSize[var] = min(_sortedSignature->sortBounds[srt],_sortModelSizes[srt]);
+      oldVarSize[var] = groundedSortSize(srt);
     }
 
-    static DArray<unsigned> grounding;
-    grounding.ensure(arity+2);
-    for(unsigned var=0;var<arity+2;var++){ grounding[var]=1; }
-    grounding[arity+1]=0;
+    // only the groundings not used for the previous sizes
+    NewGroundingIterator git(maxVarSize,oldVarSize,arity+2);
+    const DArray<unsigned>& grounding = git.grounding();
 
-newFuncLabel:
-      for(unsigned var=arity+1;var+1!=0;var--){
+    while(git.next()){
+      //cout << "Grounding: ";
+      //for(unsigned j=0;j<grounding.size();j++) cout << grounding[j] << " ";
+      //cout << endl;
 
-        if(grounding[var]==maxVarSize[var]){
-          grounding[var]=1;
-        }
-        else{
-          grounding[var]++;
-          //cout << "Grounding: ";
-          //for(unsigned j=0;j<grounding.size();j++) cout << grounding[j] << " ";
-          //cout << endl;
+      // we only need to consider the non-symmetric cases where y >= z
+      if(grounding[0]>=grounding[1]){
+        //Skip this instance
+        continue;
+      }
+      static SATLiteralStack satClauseLits;
+      satClauseLits.reset();
 
-          // we only need to consider the non-symmetric cases where y >= z
-          if(grounding[0]>=grounding[1]){
-            //Skip this instance
-            goto newFuncLabel;
-          }
-          static SATLiteralStack satClauseLits;
-          satClauseLits.reset();
+      // grounding is of the form [y,z,x1,x2,...]
+      // but use wants to be of the form use[x1,x2,...,y] and use[x1,x2,....,z]
+      // so need to do some moving around!
+      // btw we put y and z at the front so we can do the symmetry trick above
+      static DArray<unsigned> use;
+      use.ensure(arity+1);
+      for(unsigned k=0;k<arity;k++) use[k]=grounding[k+2];
+      use[arity]=grounding[0];
+      satClauseLits.push(getSATLiteral(f,use,false,true)); 
+      use[arity]=grounding[1];
+      satClauseLits.push(getSATLiteral(f,use,false,true)); 
 
-          // grounding is of the form [y,z,x1,x2,...]
-          // but use wants to be of the form use[x1,x2,...,y] and use[x1,x2,....,z]
-          // so need to do some moving around!
-          // btw we put y and z at the front so we can do the symmetry trick above
-          static DArray<unsigned> use;
-          use.ensure(arity+1);
-          for(unsigned k=0;k<arity;k++) use[k]=grounding[k+2];
-          use[arity]=grounding[0];
-          satClauseLits.push(getSATLiteral(f,use,false,true)); 
-          use[arity]=grounding[1];
-          satClauseLits.push(getSATLiteral(f,use,false,true)); 
-
-          SATClause* satCl = SATClause::fromStack(satClauseLits);
-          addSATClause(satCl);
-          goto newFuncLabel;
-        }
-      }
+      SATClause* satCl = SATClause::fromStack(satClauseLits);
+      addSATClause(satCl);
+    }
   }
 }
 
@@ -1303,6 +1531,9 @@ void FiniteModelBuilder::addNewSymmetryOrderingAxioms(unsigned size,
     SATLiteral sl = getSATLiteral(gt.f,grounding,true,true);
     satClauseLits.push(sl);
   }
+  if(_symmetryMarker){
+    satClauseLits.push(SATLiteral(_symmetryMarker,0));
+  }
   SATClause* satCl = SATClause::fromStack(satClauseLits);
   addSATClause(satCl);
 
@@ -1349,6 +1580,9 @@ void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
 
         satClauseLits.push(getSATLiteral(gtj.f,grounding_j,true,true));
       }
+      if(_symmetryMarker){
+        satClauseLits.push(SATLiteral(_symmetryMarker,0));
+      }
       addSATClause(SATClause::fromStack(satClauseLits));
   }
 
@@ -1401,7 +1635,9 @@ void FiniteModelBuilder::addNewTotalityDefs()
     // make sure to solve the problem of some sorts not growing all the way to _sortModelSizes[srt], because of _sortedSignature->sortBounds[srt]
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
       // for every sort
-      for (unsigned j = 0; j < _distinctSortSizes[i]-1; j++) {
+      // (the clauses for smaller sizes are already there)
+      unsigned from = _groundedDistinctSortSizes[i] ? _groundedDistinctSortSizes[i]-1 : 0;
+      for (unsigned j = from; j < _distinctSortSizes[i]-1; j++) {
         // for every domain size j have clause: not marker(j+1) | marker(j)
         // which says: "d > j+2" -> "d > j+1"
         static SATLiteralStack satClauseLits;
@@ -1432,6 +1668,9 @@ void FiniteModelBuilder::addNewTotalityDefs()
       // cout << "Totality for const " << f << " of sort " << srt << " and max size " << maxSize << endl;
 
       for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dsrt])) ? maxSize : 1; i <= maxSize; i++) { // just the weakest one, if monotonic
+        if (totalityDefAdded(srt,i,true)) {
+          continue;
+        }
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
 
@@ -1484,7 +1723,18 @@ newTotalLabel:
           //for(unsigned j=0;j<grounding.size();j++) cout << grounding[j] << " ";
           //cout << endl;
 
+          bool oldGrounding = true;
+          for(unsigned k=0;k<arity;k++){
+            if(grounding[k] > groundedSortSize(f_signature[k])){
+              oldGrounding = false;
+              break;
+            }
+          }
+
           for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dRetSrt])) ? maxRtSrtSize : 1; i <= maxRtSrtSize; i++) {
+            if (totalityDefAdded(retSrt,i,oldGrounding)) {
+              continue;
+            }
             static SATLiteralStack satClauseLits;
             satClauseLits.reset();
 
@@ -1510,6 +1760,29 @@ newTotalLabel:
   }
 }
 
+// Whether the totality clause saying that a term of sort srt takes one of the values 1..i
+// is already in the SAT solver; groundingAdded says whether the arguments of the term are
+// within the sizes of the previous rounds. In the contour encoding such clauses stay valid
+// for larger sizes as they are guarded by the markers, in the point-wise encoding they
+// are guarded by markers which are new in each round and so need to be added again
+bool FiniteModelBuilder::totalityDefAdded(unsigned srt, unsigned i, bool groundingAdded)
+{
+  CALL("FiniteModelBuilder::totalityDefAdded");
+
+  if(!_xmass || !groundingAdded) return false;
+
+  unsigned dsrt = _sortedSignature->parents[srt];
+  unsigned oldSize = _groundedDistinctSortSizes[dsrt];
+  unsigned oldMax = groundedSortSize(srt);
+  if(i > oldMax || (_sortedSignature->monotonicSorts[dsrt] && i != oldMax)) return false;
+
+  // the clause for the largest value uses the marker of the whole sort (see above)
+  unsigned maxSize = min(_sortedSignature->sortBounds[srt],_sortModelSizes[srt]);
+  unsigned oldMarker = (i == oldMax) ? oldSize-1 : i-1;
+  unsigned marker = (i == maxSize) ? _distinctSortSizes[dsrt]-1 : i-1;
+  return oldMarker == marker;
+}
+
 
 /*
  * We expect grounding to have [x,y] for predicate p(x,y) and [x,y,z] for function z=f(x,y)
@@ -1544,8 +1817,8 @@ SATLiteral FiniteModelBuilder::getSATLiteral(unsigned f, const DArray<unsigned>&
   for(unsigned i=0;i<grounding.size();i++){
     var += mult*(grounding[i]-1);
     unsigned srt = signature[i];
-    //cout << var << ", " << mult << "," << _sortModelSizes[srt] << endl;
-    mult *= _sortModelSizes[srt];
+    //cout << var << ", " << mult << "," << _sortCapacities[srt] << endl;
+    mult *= _sortCapacities[srt];
   }
   //cout << "return " << var << endl;
 
@@ -1562,6 +1835,7 @@ void FiniteModelBuilder::addSATClause(SATClause* cl)
 #endif
 
   _clausesToBeAdded.push(cl);
+  _solverClauseCount++;
 
 }
 
@@ -1665,6 +1939,10 @@ MainLoopResult FiniteModelBuilder::runImpl()
       TimeCounter tc(TC_FMB_SAT_SOLVING);
       _solver->addClausesIter(pvi(SATClauseStack::ConstIterator(_clausesToBeAdded)));
     }
+    // the solver now has all the clauses for the current sizes
+    for(unsigned i=0;i<_distinctSortSizes.size();i++){
+      _groundedDistinctSortSizes[i] = _distinctSortSizes[i];
+    }
 
     SATSolver::Status satResult = SATSolver::UNKNOWN;
     {
@@ -1686,6 +1964,9 @@ MainLoopResult FiniteModelBuilder::runImpl()
           assumptions.push(SATLiteral(instancesMarker_offset+i,1));
         }
       }
+      if (_symmetryMarker) {
+        assumptions.push(SATLiteral(_symmetryMarker,1));
+      }
 
       satResult = _solver->solveUnderAssumptions(assumptions);
       env.statistics->phase = Statistics::FMB_CONSTRAINT_GEN;
@@ -1699,7 +1980,8 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
     static unsigned numberOfSatCalls = 0;
     numberOfSatCalls++;
-    unsigned clauseSetSize = _clausesToBeAdded.size();
+    // in incremental mode, also count the clauses added in the previous rounds
+    unsigned clauseSetSize = _solverClauseCount;
     unsigned weight = clauseSetSize;
 
     // destroy the clauses
@@ -1723,6 +2005,9 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
         for (unsigned i = 0; i < failed.size(); i++) {
           unsigned var = failed[i].var();
+          if (var == _symmetryMarker) {
+            continue;
+          }
 
           unsigned srt = which_sort(var);
 
@@ -1802,9 +2087,12 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
         for (unsigned i = 0; i < failed.size(); i++) {
           unsigned var = failed[i].var();
-          ASS_GE(var,totalityMarker_offset);
+          if (var == _symmetryMarker) {
+            continue;
+          }
+          ASS_GE(var,min(totalityMarker_offset,instancesMarker_offset));
 
-          if (var < instancesMarker_offset) { // totality used (-> instances used as well / unless the sort is monotonic)
+          if (var >= totalityMarker_offset && var < totalityMarker_offset+_distinctSortSizes.size()) { // totality used (-> instances used as well / unless the sort is monotonic)
             unsigned dsort = var-totalityMarker_offset;
             if (_sortedSignature->monotonicSorts[dsort]) {
               nogood[dsort].first = LEQ;
@@ -80,6 +80,19 @@ private:
   // Adds constraints from grounding the non-ground clauses
   void addNewInstances();
 
+  // A literal of a flattened clause prepared for grounding, the SAT variable of its instance
+  // is base plus stride*(element-1) for each argument, see getSATLiteral
+  // For a two variable equality the two arguments are just its variables
+  struct GroundingLiteral {
+    unsigned base;
+    bool polarity;
+    bool twoVarEquality;
+    unsigned firstArg;
+    unsigned argCnt;
+  };
+  // Prepares the literals of c for grounding, the arguments are pairs of a variable and its stride
+  void compileForGrounding(Clause* c, Stack<GroundingLiteral>& lits, Stack<pair<unsigned,unsigned>>& args);
+
   // uses _distinctSortSizes to estimate how many instances would we generate
   unsigned estimateInstanceCount();
 
@@ -122,16 +135,45 @@ private:
                            bool isFunction);
 
   // resets all structures and SAT solver using _sortModelSizes 
+  // (in incremental mode, the SAT solver is kept if possible)
   bool reset();
+  // assigns SAT variables to groundings and markers using _distinctSortCapacities
+  bool layoutVariables();
+  // moves on to the current sizes keeping the SAT solver
+  bool extend();
+  // allocates the markers of clauses that only hold for the current sizes
+  bool newRoundMarkers();
+  // whether a totality clause is already in the SAT solver
+  bool totalityDefAdded(unsigned srt, unsigned i, bool groundingAdded);
 
   // make the symmetry orderings
   void createSymmetryOrdering();
   // The per-sort ordering of grounded terms used for symmetry breaking
   DArray<Stack<GroundedTerm>> _sortedGroundedTerms;
 
-  // SAT solver used to solve constraints (a new one is used for each model size)
+  // SAT solver used to solve constraints (a new one is used for each model size, unless _incremental)
   ScopedPtr<SATSolverWithAssumptions> _solver;
 
+  // Keep the SAT solver when moving to larger sizes, adding only the clauses for the new groundings
+  bool _incremental;
+  // The sizes for which SAT variables are laid out, at least the current sizes
+  // (in incremental mode larger, leaving room for the next few sizes)
+  DArray<unsigned> _distinctSortCapacities;
+  DArray<unsigned> _sortCapacities;
+  // The sizes for which clauses have already been added to the SAT solver (0 for a new solver)
+  DArray<unsigned> _groundedDistinctSortSizes;
+  unsigned groundedSortSize(unsigned srt) {
+    return min(_groundedDistinctSortSizes[_sortedSignature->parents[srt]],_sortedSignature->sortBounds[srt]);
+  }
+  bool _groundClausesAdded;
+  // number of clauses added to the current SAT solver
+  unsigned _solverClauseCount;
+  // first SAT variable not used yet
+  unsigned _nextVar;
+  // In incremental mode symmetry axioms differ from round to round, so they are guarded
+  // by this marker which is new in each round (0 if not used)
+  unsigned _symmetryMarker;
+
   // Structures to record symbols removed during preprocessing i.e. via definition elimination
   // These are ignored throughout finite model building and then the definitions (recorded here)
   // are used to give the interpretation of the function/predicate if a model is found
@@ -187,6 +229,7 @@ private:
 
   /* for each distinctSort i there is a variable (totalityMarker_offset+i)
    * which we use in the encoding to learn which domain should grow in order to possibly resolve a conflict.
+   * (in incremental mode these are new for each round)
    */
   unsigned totalityMarker_offset;
   /* for each distinctSort i there is a variable (instancesMarker_offset+i)
@@ -186,6 +186,7 @@ typedef VirtualIterator<Formula*> FormulaIterator;
 typedef Stack<Formula*> FormulaStack;
 
 class Clause;
+class ClauseFeatures;
 /** Defined as VirtualIterator<Clause*> */
 typedef VirtualIterator<Clause*> ClauseIterator;
 typedef SingleParamEvent<Clause*> ClauseEvent;
@@ -295,6 +296,8 @@ class CodeTreeTIS;
 class CodeTreeLIS;
 class CodeTreeSubsumptionIndex;
 
+class FeatureVectorIndex;
+
 class ConstraintDatabase;
 };
 
@@ -315,6 +318,9 @@ class Splitter;
 class ConsequenceFinder;
 class LabelFinder;
 class SymElOutput;
+class LemmaExchange;
+class Checkpoint;
+class SliceProgress;
 }
 
 namespace Inferences
@@ -252,6 +252,17 @@ HashingClauseVariantIndex::~HashingClauseVariantIndex()
   */
 }
 
+void HashingClauseVariantIndex::reset()
+{
+  CALL("HashingClauseVariantIndex::reset");
+
+  DHMap<unsigned, ClauseList*>::Iterator iit(_entries);
+  while(iit.hasNext()){
+    ClauseList::destroy(iit.next());
+  }
+  _entries.reset();
+}
+
 void HashingClauseVariantIndex::insert(Clause* cl)
 {
   CALL("HashingClauseVariantIndex::insert");
@@ -84,8 +84,11 @@ public:
   virtual ~HashingClauseVariantIndex() override;
 
   virtual void insert(Clause* cl) override;
+  /** Remove all clauses, keeping the memory of the hash table */
+  void reset();
 
   ClauseIterator retrieveVariants(Literal* const * lits, unsigned length) override;
+  using ClauseVariantIndex::retrieveVariants;
 
 private:
   struct VariableIgnoringComparator;
@@ -19,6 +19,7 @@
 #include "Lib/BitUtils.hpp"
 #include "Lib/Comparison.hpp"
 #include "Lib/Int.hpp"
+#include "Lib/KeySearch.hpp"
 #include "Lib/Portability.hpp"
 #include "Lib/Sort.hpp"
 #include "Lib/TimeCounter.hpp"
@@ -557,22 +558,10 @@ CodeTree::CodeOp*& CodeTree::FnSearchStruct::targetOp(unsigned fn)
 {
   CALL("CodeTree::FnSearchStruct::findTargetOp");
 
-  size_t left=0;
-  size_t right=length-1;
-  while(left<right) {
-    size_t mid=(left+right)/2;
-    switch(Int::compare(fn, values[mid])) {
-    case LESS:
-      right=mid;
-      break;
-    case GREATER:
-      left=mid+1;
-      break;
-    case EQUAL:
-      return targets[mid];
-    }
+  size_t left=KeySearch::lowerBound(values, length, fn);
+  if(left==length) {
+    left=length-1;
   }
-  ASS_EQ(left,right);
   ASS(left==length-1 || fn<=values[left]);
   return targets[left];
 //  if(fn>values[left]) {
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file FeatureVectorIndex.cpp
+ * Implements class FeatureVectorIndex.
+ */
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/ClauseFeatures.hpp"
+
+#include "Lib/TimeCounter.hpp"
+
+#include "FeatureVectorIndex.hpp"
+
+namespace Indexing
+{
+
+FeatureVectorIndex::FeatureVectorIndex()
+: _root(new Node())
+{
+}
+
+FeatureVectorIndex::~FeatureVectorIndex()
+{
+  CALL("FeatureVectorIndex::~FeatureVectorIndex");
+
+  destroy(_root);
+}
+
+void FeatureVectorIndex::destroy(Node* n)
+{
+  CALL("FeatureVectorIndex::destroy");
+
+  Stack<Node*> todo;
+  todo.push(n);
+  while(todo.isNonEmpty()) {
+    Node* curr = todo.pop();
+    for(unsigned i=0;i<curr->children.size();i++) {
+      todo.push(curr->children[i].second);
+    }
+    delete curr;
+  }
+}
+
+void FeatureVectorIndex::handleClause(Clause* c, bool adding)
+{
+  CALL("FeatureVectorIndex::handleClause");
+
+  TimeCounter tc(TC_BACKWARD_SUBSUMPTION_INDEX_MAINTENANCE);
+
+  if(adding) {
+    insert(c);
+  }
+  else {
+    remove(c);
+  }
+}
+
+void FeatureVectorIndex::insert(Clause* c)
+{
+  CALL("FeatureVectorIndex::insert");
+
+  const ClauseFeatures& features = c->features();
+  Node* n = _root;
+  for(unsigned i=0;i<ClauseFeatures::COUNTERS;i++) {
+    unsigned val = features.counter(i);
+    Stack<Edge>& children = n->children;
+    unsigned pos = 0;
+    while(pos<children.size() && children[pos].first<val) {
+      pos++;
+    }
+    if(pos==children.size() || children[pos].first!=val) {
+      // keep the children ordered by inserting the new one at pos
+      children.push(Edge(val, 0));
+      for(unsigned j=children.size()-1;j>pos;j--) {
+        children[j] = children[j-1];
+      }
+      children[pos] = Edge(val, new Node());
+    }
+    n = children[pos].second;
+  }
+  n->clauses.push(c);
+}
+
+void FeatureVectorIndex::remove(Clause* c)
+{
+  CALL("FeatureVectorIndex::remove");
+
+  const ClauseFeatures& features = c->features();
+  static Stack<pair<Node*,unsigned>> path;
+  path.reset();
+
+  Node* n = _root;
+  for(unsigned i=0;i<ClauseFeatures::COUNTERS;i++) {
+    unsigned val = features.counter(i);
+    Stack<Edge>& children = n->children;
+    unsigned pos = 0;
+    while(pos<children.size() && children[pos].first!=val) {
+      pos++;
+    }
+    ASS_L(pos, children.size());
+    path.push(make_pair(n, pos));
+    n = children[pos].second;
+  }
+  ALWAYS(n->clauses.remove(c));
+
+  // delete the nodes that no longer lead to any clause
+  while(path.isNonEmpty() && n->clauses.isEmpty() && n->children.isEmpty()) {
+    delete n;
+    Node* parent = path.top().first;
+    unsigned pos = path.pop().second;
+    Stack<Edge>& children = parent->children;
+    for(unsigned j=pos;j+1<children.size();j++) {
+      children[j] = children[j+1];
+    }
+    children.pop();
+    n = parent;
+  }
+}
+
+/**
+ * Add to @b result all indexed clauses whose feature vectors do not
+ * exclude that they are subsumed by @b cl
+ */
+void FeatureVectorIndex::getPossiblySubsumed(Clause* cl, Stack<Clause*>& result)
+{
+  CALL("FeatureVectorIndex::getPossiblySubsumed");
+
+  const ClauseFeatures& features = cl->features();
+  static Stack<pair<Node*,unsigned>> todo;
+  todo.reset();
+  todo.push(make_pair(_root, 0u));
+  while(todo.isNonEmpty()) {
+    Node* n = todo.top().first;
+    unsigned level = todo.pop().second;
+    if(level==ClauseFeatures::COUNTERS) {
+      result.loadFromIterator(Stack<Clause*>::Iterator(n->clauses));
+      continue;
+    }
+    unsigned min = features.counter(level);
+    Stack<Edge>& children = n->children;
+    for(unsigned i=children.size();i>0 && children[i-1].first>=min;i--) {
+      todo.push(make_pair(children[i-1].second, level+1));
+    }
+  }
+}
+
+}
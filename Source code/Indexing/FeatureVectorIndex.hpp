@@ -0,0 +1,79 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file FeatureVectorIndex.hpp
+ * Defines class FeatureVectorIndex.
+ */
+
+#ifndef __FeatureVectorIndex__
+#define __FeatureVectorIndex__
+
+#include "Forwards.hpp"
+
+#include "Lib/Stack.hpp"
+
+#include "Index.hpp"
+
+namespace Indexing {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Index of clauses by their feature vectors (see Kernel::ClauseFeatures),
+ * retrieving the clauses that may be subsumed by a given clause.
+ *
+ * The feature vectors are stored in a trie with one level per counter.
+ * The children of a node are ordered by the value of the next counter,
+ * so a query only descends into the children whose value is at least the
+ * value of the query clause. Clauses with equal feature vectors share
+ * a leaf.
+ */
+class FeatureVectorIndex
+: public Index
+{
+public:
+  CLASS_NAME(FeatureVectorIndex);
+  USE_ALLOCATOR(FeatureVectorIndex);
+
+  FeatureVectorIndex();
+  ~FeatureVectorIndex();
+
+  void getPossiblySubsumed(Clause* cl, Stack<Clause*>& result);
+
+protected:
+  void handleClause(Clause* c, bool adding);
+
+private:
+  struct Node;
+  /** Child of a node together with the counter value leading to it */
+  typedef pair<unsigned, Node*> Edge;
+
+  struct Node
+  {
+    CLASS_NAME(FeatureVectorIndex::Node);
+    USE_ALLOCATOR(FeatureVectorIndex::Node);
+
+    /** children ordered by the counter value, empty for leaves */
+    Stack<Edge> children;
+    /** clauses with the feature vector leading to the node if it is a leaf */
+    Stack<Clause*> clauses;
+  };
+
+  void insert(Clause* c);
+  void remove(Clause* c);
+  static void destroy(Node* n);
+
+  Node* _root;
+};
+
+}
+
+#endif // __FeatureVectorIndex__
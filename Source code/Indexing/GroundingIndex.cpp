@@ -21,6 +21,7 @@
 
 #include "Shell/Options.hpp"
 
+#include "SAT/CDCLSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/BufferedSolver.hpp"
 
@@ -41,6 +42,9 @@ GroundingIndex::GroundingIndex(const Options& opt)
     case Options::SatSolver::MINISAT:
       _solver = new MinisatInterfacing(opt,true);
       break;
+    case Options::SatSolver::CDCL:
+      _solver = new CDCLSolver(opt,true);
+      break;
     default:
       ASSERTION_VIOLATION_REP(opt.satSolver());
   }
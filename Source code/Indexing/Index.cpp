@@ -13,6 +13,12 @@
  *
  */
 
+#include "Lib/Environment.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Shell/Statistics.hpp"
+
 #include "Index.hpp"
 
 
@@ -23,6 +29,8 @@ using namespace Lib;
 using namespace Kernel;
 using namespace Saturation;
 
+bool Index::s_suspendRemovals = false;
+
 Index::~Index()
 {
   if(!_addedSD.isEmpty()) {
@@ -30,6 +38,15 @@ Index::~Index()
     _addedSD->unsubscribe();
     _removedSD->unsubscribe();
   }
+
+  DHMap<Clause*,SuspendedClause*>::Iterator sit(_suspended);
+  while(sit.hasNext()) {
+    Clause* c;
+    SuspendedClause* sc;
+    sit.next(c, sc);
+    delete sc;
+    c->decRefCnt();
+  }
 }
 
 /**
@@ -45,4 +62,124 @@ void Index::attachContainer(ClauseContainer* cc)
   _removedSD = cc->removedEvent.subscribe(this,&Index::onRemovedFromContainer);
 }
 
+Index::SuspendedClause::SuspendedClause(Clause* c)
+: numSelected(c->numSelected()), literals(c->length())
+{
+  for(unsigned i=0; i<c->length(); i++) {
+    literals[i] = (*c)[i];
+  }
+}
+
+bool Index::SuspendedClause::matches(Clause* c) const
+{
+  if(c->numSelected()!=numSelected) {
+    return false;
+  }
+  for(unsigned i=0; i<c->length(); i++) {
+    if((*c)[i]!=literals[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Index::onAddedToContainer(Clause* c)
+{
+  CALL("Index::onAddedToContainer");
+
+  SuspendedClause* sc;
+  if(_suspended.pop(c, sc)) {
+    if(sc->matches(c)) {
+      // the clause is coming back (typically after an AVATAR model change)
+      // and its entries have never left the index
+      env.statistics->resumedIndexEntries++;
+    } else {
+      // the literals were selected differently this time
+      removeSuspended(c, sc);
+      handleClause(c, true);
+    }
+    delete sc;
+    c->decRefCnt(); // belonged to _suspended
+    return;
+  }
+  _indexedClauses++;
+  handleClause(c, true);
+}
+
+/**
+ * Remove the entries of @b c from the index, unless Index::s_suspendRemovals
+ * is set. In that case the clause is only marked as suspended, so that it is
+ * skipped by retrievals and its reinsertion is for free. The indexing
+ * structure is cleaned up only once the suspended clauses make up more than
+ * a half of the indexed ones.
+ */
+void Index::onRemovedFromContainer(Clause* c)
+{
+  CALL("Index::onRemovedFromContainer");
+
+  if(s_suspendRemovals && _suspendable) {
+    ALWAYS(_suspended.insert(c, new SuspendedClause(c)));
+    c->incRefCnt(); // the entries still refer to the clause
+    env.statistics->suspendedIndexRemovals++;
+
+    if(_suspended.size()>64 && 2*_suspended.size()>_indexedClauses) {
+      purgeSuspended();
+    }
+    return;
+  }
+  ASS(!_suspended.find(c));
+  _indexedClauses--;
+  handleClause(c, false);
+}
+
+/**
+ * Remove the entries of the suspended clause @b c
+ *
+ * The clause may have been selected again since it was suspended, so the
+ * literal order and selection recorded in @b sc are put back for the removal.
+ */
+void Index::removeSuspended(Clause* c, SuspendedClause* sc)
+{
+  CALL("Index::removeSuspended");
+
+  if(sc->matches(c)) {
+    handleClause(c, false);
+    return;
+  }
+
+  unsigned len = c->length();
+  unsigned currSelected = c->numSelected();
+  static Stack<Literal*> currLits;
+  currLits.reset();
+  for(unsigned i=0; i<len; i++) {
+    currLits.push((*c)[i]);
+    (*c)[i] = sc->literals[i];
+  }
+  c->setSelected(sc->numSelected);
+
+  handleClause(c, false);
+
+  for(unsigned i=0; i<len; i++) {
+    (*c)[i] = currLits[i];
+  }
+  c->setSelected(currSelected);
+}
+
+void Index::purgeSuspended()
+{
+  CALL("Index::purgeSuspended");
+
+  DHMap<Clause*,SuspendedClause*>::DelIterator sit(_suspended);
+  while(sit.hasNext()) {
+    Clause* c;
+    SuspendedClause* sc;
+    sit.next(c, sc);
+    sit.del();
+    _indexedClauses--;
+    removeSuspended(c, sc);
+    delete sc;
+    c->decRefCnt(); // belonged to _suspended
+  }
+}
+
 }
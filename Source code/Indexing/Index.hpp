@@ -17,8 +17,11 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Event.hpp"
 #include "Lib/Exception.hpp"
+#include "Lib/Metaiterators.hpp"
 #include "Lib/VirtualIterator.hpp"
 #include "Saturation/ClauseContainer.hpp"
 #include "ResultSubstitution.hpp"
@@ -124,21 +127,68 @@ public:
   virtual ~Index();
 
   void attachContainer(ClauseContainer* cc);
+
+  /**
+   * While true, clauses removed from the containers of suspendable indices
+   * keep their index entries, see Index::onRemovedFromContainer
+   */
+  static bool s_suspendRemovals;
 protected:
-  Index() {}
+  Index() : _suspendable(false), _indexedClauses(0) {}
 
-  void onAddedToContainer(Clause* c)
-  { handleClause(c, true); }
-  void onRemovedFromContainer(Clause* c)
-  { handleClause(c, false); }
+  void onAddedToContainer(Clause* c);
+  void onRemovedFromContainer(Clause* c);
 
   virtual void handleClause(Clause* c, bool adding) {}
 
+  /**
+   * Remove from the results of a retrieval the entries of suspended clauses
+   */
+  template<class QueryResult>
+  VirtualIterator<QueryResult> skipSuspended(VirtualIterator<QueryResult> it)
+  {
+    if(_suspended.isEmpty()) {
+      return it;
+    }
+    return pvi( getFilteredIterator(it,
+        [this](const QueryResult& qr) { return !_suspended.find(qr.clause); }) );
+  }
+
+  /**
+   * True if the index filters its retrievals through skipSuspended and its
+   * handleClause does nothing but update the indexing structure
+   */
+  bool _suspendable;
+
   //TODO: postponing index modifications during iteration (methods isBeingIterated() etc...)
 
 private:
+  /**
+   * Literal order and selection of a clause at the time it was suspended,
+   * i.e. the ones its index entries were created for
+   */
+  struct SuspendedClause
+  {
+    CLASS_NAME(Index::SuspendedClause);
+    USE_ALLOCATOR(SuspendedClause);
+
+    SuspendedClause(Clause* c);
+    bool matches(Clause* c) const;
+
+    unsigned numSelected;
+    DArray<Literal*> literals;
+  };
+
+  void removeSuspended(Clause* c, SuspendedClause* sc);
+  void purgeSuspended();
+
   SubscriptionData _addedSD;
   SubscriptionData _removedSD;
+
+  /** Clauses removed from the container whose entries are still in the index */
+  DHMap<Clause*,SuspendedClause*> _suspended;
+  /** Number of clauses with entries in the index, including the suspended ones */
+  unsigned _indexedClauses;
 };
 
 
@@ -20,6 +20,7 @@
 
 #include "AcyclicityIndex.hpp"
 #include "CodeTreeInterfaces.hpp"
+#include "FeatureVectorIndex.hpp"
 #include "GroundingIndex.hpp"
 #include "LiteralIndex.hpp"
 #include "LiteralSubstitutionTree.hpp"
@@ -267,6 +268,11 @@ Index* IndexManager::create(IndexType t)
     isGenerating = false;
     break;
 
+  case BW_SUBSUMPTION_FEATURE_VECTOR_INDEX:
+    res=new FeatureVectorIndex();
+    isGenerating = false;
+    break;
+
   case FSD_SUBST_TREE:
     is = new LiteralSubstitutionTree();
     res = new FSDLiteralIndex(is);
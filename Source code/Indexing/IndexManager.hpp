@@ -46,6 +46,7 @@ enum IndexType {
 
   FW_SUBSUMPTION_SUBST_TREE,
   BW_SUBSUMPTION_SUBST_TREE,
+  BW_SUBSUMPTION_FEATURE_VECTOR_INDEX,
 
   FSD_SUBST_TREE,
 
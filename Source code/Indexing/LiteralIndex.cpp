@@ -38,33 +38,37 @@ LiteralIndex::~LiteralIndex()
 
 SLQueryResultIterator LiteralIndex::getAll()
 {
-  return _is->getAll();
+  return skipSuspended(_is->getAll());
 }
 
 SLQueryResultIterator LiteralIndex::getUnifications(Literal* lit,
 	  bool complementary, bool retrieveSubstitutions)
 {
-  return _is->getUnifications(lit, complementary, retrieveSubstitutions);
+  return skipSuspended(_is->getUnifications(lit, complementary, retrieveSubstitutions));
 }
 
 SLQueryResultIterator LiteralIndex::getUnificationsWithConstraints(Literal* lit,
           bool complementary, bool retrieveSubstitutions)
 {
-  return _is->getUnificationsWithConstraints(lit, complementary, retrieveSubstitutions);
+  return skipSuspended(_is->getUnificationsWithConstraints(lit, complementary, retrieveSubstitutions));
 }
 
 SLQueryResultIterator LiteralIndex::getGeneralizations(Literal* lit,
 	  bool complementary, bool retrieveSubstitutions)
 {
-  return _is->getGeneralizations(lit, complementary, retrieveSubstitutions);
+  return skipSuspended(_is->getGeneralizations(lit, complementary, retrieveSubstitutions));
 }
 
 SLQueryResultIterator LiteralIndex::getInstances(Literal* lit,
 	  bool complementary, bool retrieveSubstitutions)
 {
-  return _is->getInstances(lit, complementary, retrieveSubstitutions);
+  return skipSuspended(_is->getInstances(lit, complementary, retrieveSubstitutions));
 }
 
+/**
+ * Return the number of unifying entries. Entries of suspended clauses are
+ * counted as well, so the result is only an upper bound.
+ */
 size_t LiteralIndex::getUnificationCount(Literal* lit, bool complementary)
 {
   return _is->getUnificationCount(lit, complementary);
@@ -186,6 +190,8 @@ void NonUnitClauseLiteralIndex::handleClause(Clause* c, bool adding)
 RewriteRuleIndex::RewriteRuleIndex(LiteralIndexingStructure* is, Ordering& ordering)
 : LiteralIndex(is), _ordering(ordering)
 {
+  // the counterpart pairing cannot be kept for removed clauses
+  _suspendable = false;
   _partialIndex=new LiteralSubstitutionTree();
 }
 
@@ -50,7 +50,7 @@ public:
 
 
 protected:
-  LiteralIndex(LiteralIndexingStructure* is) : _is(is) {}
+  LiteralIndex(LiteralIndexingStructure* is) : _is(is) { _suspendable = true; }
 
   void handleLiteral(Literal* lit, Clause* cl, bool add);
 
@@ -678,7 +678,7 @@ bool SubstitutionTree::LeafIterator::hasNext()
 SubstitutionTree::UnificationsIterator::UnificationsIterator(SubstitutionTree* parent,
 	Node* root, Term* query, bool retrieveSubstitution, bool reversed, 
   bool withoutTop, bool useC, FuncSubtermMap* funcSubtermMap)
-: tag(parent->tag), 
+: tag(parent->tag), subst(acquireSubstitution()),
 svStack(32), literalRetrieval(query->isLiteral()),
   retrieveSubstitution(retrieveSubstitution), inLeaf(false),
 ldIterator(LDIterator::getEmpty()), nodeIterators(8), bdStack(8),
@@ -742,12 +742,61 @@ SubstitutionTree::UnificationsIterator::~UnificationsIterator()
   while(bdStack.isNonEmpty()) {
     bdStack.pop().backtrack();
   }
+  releaseSubstitution(subst);
 
 #if VDEBUG
   tree->_iteratorCnt--;
 #endif
 }
 
+/**
+ * Substitutions of finished unification iterators, kept for reuse
+ */
+struct SubstitutionPool
+{
+  ~SubstitutionPool()
+  {
+    while(substs.isNonEmpty()) {
+      delete substs.pop();
+    }
+  }
+  Stack<RobSubstitution*> substs;
+};
+
+static SubstitutionPool& substitutionPool()
+{
+  static SubstitutionPool pool;
+  return pool;
+}
+
+/**
+ * Return an empty substitution for a new iterator.
+ *
+ * Retrievals are very frequent and mostly short, so rather than building
+ * a fresh substitution each time, whose variable bank would then grow from
+ * the minimal capacity, we recycle the substitutions of finished iterators.
+ * Resetting the bank of a recycled substitution takes constant time.
+ */
+RobSubstitution& SubstitutionTree::UnificationsIterator::acquireSubstitution()
+{
+  CALL("SubstitutionTree::UnificationsIterator::acquireSubstitution");
+
+  Stack<RobSubstitution*>& pool = substitutionPool().substs;
+  if(pool.isEmpty()) {
+    return *new RobSubstitution();
+  }
+  RobSubstitution* res = pool.pop();
+  res->reset();
+  return *res;
+}
+
+void SubstitutionTree::UnificationsIterator::releaseSubstitution(RobSubstitution& s)
+{
+  CALL("SubstitutionTree::UnificationsIterator::releaseSubstitution");
+
+  substitutionPool().substs.push(&s);
+}
+
 void SubstitutionTree::UnificationsIterator::createInitialBindings(Term* t)
 {
   CALL("SubstitutionTree::UnificationsIterator::createInitialBindings");
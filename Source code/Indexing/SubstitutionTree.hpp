@@ -54,6 +54,7 @@ using namespace Lib;
 using namespace Kernel;
 
 #define UARR_INTERMEDIATE_NODE_MAX_SIZE 4
+#define SARR_INTERMEDIATE_NODE_INITIAL_CAPACITY 8
 
 #define REORDERING 1
 
@@ -169,7 +170,8 @@ public:
   {
     UNSORTED_LIST=1,
     SKIP_LIST=2,
-    SET=3
+    SET=3,
+    SORTED_ARRAY=4
   };
 
   class Node {
@@ -446,6 +448,7 @@ public:
   class UListLeaf;
   class SListIntermediateNode;
   class SListLeaf;
+  class SArrLeaf;
   class SetLeaf;
   static Leaf* createLeaf();
   static Leaf* createLeaf(TermList ts);
@@ -646,6 +649,102 @@ public:
    }
   };
 
+  /**
+   * Intermediate node keeping its children in a contiguous array sorted
+   * by their top symbols, variable children first. The top symbols are
+   * stored inline as keys in a parallel array, so a child is found by a
+   * binary search that does not dereference the child nodes.
+   *
+   * The array of children is null-terminated, so that pointers into it
+   * can be traversed in the same way as the children of UArrIntermediateNode.
+   */
+  class SArrIntermediateNode
+  : public IntermediateNode
+  {
+  public:
+    SArrIntermediateNode(unsigned childVar) : IntermediateNode(childVar)
+    { init(); }
+    SArrIntermediateNode(TermList ts, unsigned childVar) : IntermediateNode(ts, childVar)
+    { init(); }
+
+    ~SArrIntermediateNode()
+    {
+      if(!isEmpty()) {
+	destroyChildren();
+      }
+      DEALLOC_KNOWN(_keys,_capacity*sizeof(unsigned),"SubstitutionTree::SArrIntermediateNode");
+      DEALLOC_KNOWN(_nodes,(_capacity+1)*sizeof(Node*),"SubstitutionTree::SArrIntermediateNode");
+    }
+
+    void removeAllChildren()
+    {
+      _size=0;
+      _nodes[0]=0;
+    }
+
+    static IntermediateNode* assimilate(IntermediateNode* orig);
+
+    inline
+    NodeAlgorithm algorithm() const { return SORTED_ARRAY; }
+    inline
+    bool isEmpty() const { return !_size; }
+    int size() const { return _size; }
+#if VDEBUG
+    virtual void assertValid() const
+    {
+      ASS_ALLOC_TYPE(this,"SubstitutionTree::SArrIntermediateNode");
+    }
+#endif
+    inline
+    NodeIterator allChildren()
+    { return pvi( PointerPtrIterator<Node*>(&_nodes[0],&_nodes[_size]) ); }
+    inline
+    NodeIterator variableChildren()
+    {
+      return pvi( getWhileLimitedIterator(
+		    PointerPtrIterator<Node*>(&_nodes[0],&_nodes[_size]),
+		    IsPtrToVarNodeFn()) );
+    }
+    virtual Node** childByTop(TermList t, bool canCreate);
+    void remove(TermList t);
+
+    /**
+     * Return the key of the top symbol of @b t. Keys of variables are
+     * smaller than keys of functions, so variable children come first.
+     */
+    static unsigned key(TermList t)
+    { return t.isVar() ? t.var() : (t.term()->functor() | FUNCTION_KEY_FLAG); }
+
+    CLASS_NAME(SubstitutionTree::SArrIntermediateNode);
+    USE_ALLOCATOR(SArrIntermediateNode);
+
+    static const unsigned FUNCTION_KEY_FLAG = 0x80000000u;
+
+    int _size;
+    int _capacity;
+    /** keys of the top symbols of the children, in increasing order */
+    unsigned* _keys;
+    /** the children, terminated by a null pointer */
+    Node** _nodes;
+
+  private:
+    void init();
+    int position(unsigned key) const;
+    void expand();
+  };
+
+  class SArrIntermediateNodeWithSorts
+  : public SArrIntermediateNode
+  {
+   public:
+   SArrIntermediateNodeWithSorts(unsigned childVar) : SArrIntermediateNode(childVar) {
+       _childBySortHelper = new ChildBySortHelper(this);
+   }
+   SArrIntermediateNodeWithSorts(TermList ts, unsigned childVar) : SArrIntermediateNode(ts, childVar) {
+       _childBySortHelper = new ChildBySortHelper(this);
+   }
+  };
+
   class Binding {
   public:
     /** Number of the variable at this node */
@@ -867,7 +966,11 @@ public:
     static const int NORM_QUERY_BANK=2;
     static const int NORM_RESULT_BANK=3;
 
-    RobSubstitution subst;
+    static RobSubstitution& acquireSubstitution();
+    static void releaseSubstitution(RobSubstitution& s);
+
+    /** taken from a pool of recycled substitutions, see acquireSubstitution() */
+    RobSubstitution& subst;
     VarStack svStack;
 
   private:
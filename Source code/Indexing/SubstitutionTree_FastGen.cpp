@@ -539,6 +539,17 @@ main_loop_start:
 	} else {
 	  sibilingsRemain=false;
 	}
+      } else if(parentType==SORTED_ARRAY) {
+	//in sorted array nodes variables are only at the beginning
+	Node** alts=static_cast<Node**>(currAlt);
+	ASS((*alts)->term.isVar());
+	curr=*(alts++);
+	if(*alts && (*alts)->term.isVar()) {
+	  _alternatives.push(alts);
+	  sibilingsRemain=true;
+	} else {
+	  sibilingsRemain=false;
+	}
       } else {
 	ASS_EQ(parentType,SKIP_LIST)
 	NodeList* alts=static_cast<NodeList*>(currAlt);
@@ -674,6 +685,27 @@ bool SubstitutionTree::FastGeneralizationsIterator::enterNode(Node*& curr)
       _nodeTypes.push(currType);
       return true;
     }
+  } else if(currType==SORTED_ARRAY) {
+    Node** nl=static_cast<SArrIntermediateNode*>(inode)->_nodes;
+    if(binding.isTerm()) {
+      Node** byTop=inode->childByTop(binding, false);
+      if(byTop) {
+	curr=*byTop;
+      }
+    }
+    if(!curr && (*nl)->term.isVar()) {
+      curr=*(nl++);
+    }
+    if(curr) {
+      _specVarNumbers.push(inode->childVar);
+    }
+    //variables are only at the beginning, so if the next child
+    //isn't a variable, there are no alternatives
+    if(*nl && (*nl)->term.isVar()) {
+      _alternatives.push(nl);
+      _nodeTypes.push(currType);
+      return true;
+    }
   } else {
     NodeList* nl;
     ASS_EQ(currType, SKIP_LIST);
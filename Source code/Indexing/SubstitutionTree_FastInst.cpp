@@ -735,7 +735,7 @@ main_loop_start:
       //the fact that we have alternatives means that here we are
       //matching by a variable (as there is always at most one child
       //for matching by term)
-      if(parentType==UNSORTED_LIST) {
+      if(parentType==UNSORTED_LIST || parentType==SORTED_ARRAY) {
 	Node** alts=static_cast<Node**>(currAlt);
 	curr=*(alts++);
 	if(*alts) {
@@ -881,6 +881,27 @@ bool SubstitutionTree::FastInstancesIterator::enterNode(Node*& curr)
       _nodeTypes.push(currType);
       return true;
     }
+  } else if(currType==SORTED_ARRAY) {
+    Node** nl=static_cast<SArrIntermediateNode*>(inode)->_nodes;
+    ASS(*nl); //inode is not empty
+    if(query.isTerm()) {
+      //only term with the same top functor will be matched by a term
+      Node** byTop=inode->childByTop(query, false);
+      if(byTop) {
+	curr=*byTop;
+	_specVarNumbers.push(inode->childVar);
+      }
+      return false;
+    }
+    ASS(query.isVar());
+    //everything is matched by a variable
+    curr=*(nl++);
+    _specVarNumbers.push(inode->childVar);
+    if(*nl) {
+      _alternatives.push(nl);
+      _nodeTypes.push(currType);
+      return true;
+    }
   } else {
     NodeList* nl;
     ASS_EQ(currType, SKIP_LIST);
@@ -15,6 +15,7 @@
 
 #include "Lib/DHMultiset.hpp"
 #include "Lib/Exception.hpp"
+#include "Lib/KeySearch.hpp"
 #include "Lib/List.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/SkipList.hpp"
@@ -118,6 +119,86 @@ private:
 };
 
 
+/**
+ * Leaf keeping its data in a contiguous array sorted in the same order
+ * as in SListLeaf.
+ */
+class SubstitutionTree::SArrLeaf
+: public Leaf
+{
+public:
+  SArrLeaf() {}
+  SArrLeaf(TermList ts) : Leaf(ts) {}
+
+  static SArrLeaf* assimilate(Leaf* orig);
+
+  inline
+  NodeAlgorithm algorithm() const { return SORTED_ARRAY; }
+  inline
+  bool isEmpty() const { return _children.isEmpty(); }
+  inline
+  int size() const { return _children.size(); }
+  inline
+  LDIterator allChildren()
+  {
+    return pvi( RefIterator(_children.begin(), _children.end()) );
+  }
+  void insert(LeafData ld)
+  {
+    CALL("SubstitutionTree::SArrLeaf::insert");
+
+    _children.push(ld);
+    //data usually come in the increasing order, so we search from the end
+    LeafData* arr=_children.begin();
+    size_t i=_children.size()-1;
+    while(i>0 && LDComparator::compare(arr[i-1],ld)==GREATER) {
+      arr[i]=arr[i-1];
+      i--;
+    }
+    arr[i]=ld;
+  }
+  void remove(LeafData ld)
+  {
+    CALL("SubstitutionTree::SArrLeaf::remove");
+
+    LeafData* arr=_children.begin();
+    size_t lo=0;
+    size_t hi=_children.size();
+    while(lo<hi) {
+      size_t mid=(lo+hi)/2;
+      if(LDComparator::compare(arr[mid],ld)==LESS) {
+        lo=mid+1;
+      } else {
+        hi=mid;
+      }
+    }
+    ASS_L(lo,_children.size());
+    ASS_EQ(LDComparator::compare(arr[lo],ld),EQUAL);
+    for(size_t i=lo+1;i<_children.size();i++) {
+      arr[i-1]=arr[i];
+    }
+    _children.pop();
+  }
+
+  CLASS_NAME(SubstitutionTree::SArrLeaf);
+  USE_ALLOCATOR(SArrLeaf);
+private:
+  class RefIterator
+  {
+  public:
+    DECL_ELEMENT_TYPE(LeafData&);
+    RefIterator(LeafData* first, LeafData* afterLast) : _curr(first), _afterLast(afterLast) {}
+    bool hasNext() { return _curr!=_afterLast; }
+    LeafData& next() { ASS(hasNext()); return *(_curr++); }
+  private:
+    LeafData* _curr;
+    LeafData* _afterLast;
+  };
+
+  Stack<LeafData> _children;
+};
+
+
 SubstitutionTree::Leaf* SubstitutionTree::createLeaf()
 {
   return new UListLeaf();
@@ -198,6 +279,117 @@ void SubstitutionTree::UArrIntermediateNode::remove(TermList t)
   ASSERTION_VIOLATION;
 }
 
+void SubstitutionTree::SArrIntermediateNode::init()
+{
+  CALL("SubstitutionTree::SArrIntermediateNode::init");
+
+  _size=0;
+  _capacity=SARR_INTERMEDIATE_NODE_INITIAL_CAPACITY;
+  _keys=static_cast<unsigned*>(ALLOC_KNOWN(_capacity*sizeof(unsigned),"SubstitutionTree::SArrIntermediateNode"));
+  _nodes=static_cast<Node**>(ALLOC_KNOWN((_capacity+1)*sizeof(Node*),"SubstitutionTree::SArrIntermediateNode"));
+  _nodes[0]=0;
+}
+
+/**
+ * Return the position of the first child whose key is not smaller
+ * than @b key
+ */
+int SubstitutionTree::SArrIntermediateNode::position(unsigned key) const
+{
+  return KeySearch::lowerBound(_keys, _size, key);
+}
+
+/**
+ * Double the capacity of the arrays of keys and children
+ */
+void SubstitutionTree::SArrIntermediateNode::expand()
+{
+  CALL("SubstitutionTree::SArrIntermediateNode::expand");
+
+  int newCapacity=_capacity*2;
+  unsigned* newKeys=static_cast<unsigned*>(ALLOC_KNOWN(newCapacity*sizeof(unsigned),"SubstitutionTree::SArrIntermediateNode"));
+  Node** newNodes=static_cast<Node**>(ALLOC_KNOWN((newCapacity+1)*sizeof(Node*),"SubstitutionTree::SArrIntermediateNode"));
+  for(int i=0;i<_size;i++) {
+    newKeys[i]=_keys[i];
+    newNodes[i]=_nodes[i];
+  }
+  newNodes[_size]=0;
+  DEALLOC_KNOWN(_keys,_capacity*sizeof(unsigned),"SubstitutionTree::SArrIntermediateNode");
+  DEALLOC_KNOWN(_nodes,(_capacity+1)*sizeof(Node*),"SubstitutionTree::SArrIntermediateNode");
+  _keys=newKeys;
+  _nodes=newNodes;
+  _capacity=newCapacity;
+}
+
+SubstitutionTree::Node** SubstitutionTree::SArrIntermediateNode::
+	childByTop(TermList t, bool canCreate)
+{
+  CALL("SubstitutionTree::SArrIntermediateNode::childByTop");
+
+  unsigned k=key(t);
+  int pos=position(k);
+  if(pos<_size && _keys[pos]==k) {
+    return &_nodes[pos];
+  }
+  if(!canCreate) {
+    return 0;
+  }
+  mightExistAsTop(t);
+  if(_size==_capacity) {
+    expand();
+  }
+  for(int i=_size;i>pos;i--) {
+    _keys[i]=_keys[i-1];
+    _nodes[i]=_nodes[i-1];
+  }
+  _size++;
+  _nodes[_size]=0;
+  _keys[pos]=k;
+  _nodes[pos]=0;
+  return &_nodes[pos];
+}
+
+void SubstitutionTree::SArrIntermediateNode::remove(TermList t)
+{
+  CALL("SubstitutionTree::SArrIntermediateNode::remove");
+
+  unsigned k=key(t);
+  int pos=position(k);
+  ASS_L(pos,_size);
+  ASS_EQ(_keys[pos],k);
+  _size--;
+  for(int i=pos;i<_size;i++) {
+    _keys[i]=_keys[i+1];
+    _nodes[i]=_nodes[i+1];
+  }
+  _nodes[_size]=0;
+  if(_childBySortHelper){
+    _childBySortHelper->remove(t);
+  }
+}
+
+/**
+ * Take an IntermediateNode, destroy it, and return
+ * SArrIntermediateNode with the same content.
+ */
+SubstitutionTree::IntermediateNode* SubstitutionTree::SArrIntermediateNode
+	::assimilate(IntermediateNode* orig)
+{
+  CALL("SubstitutionTree::SArrIntermediateNode::assimilate");
+
+  IntermediateNode* res= 0;
+  if(orig->withSorts()){
+    res = new SArrIntermediateNodeWithSorts(orig->term, orig->childVar);
+    res->_childBySortHelper->loadFrom(orig->_childBySortHelper);
+  }else{
+    res = new SArrIntermediateNode(orig->term, orig->childVar);
+  }
+  res->loadChildren(orig->allChildren());
+  orig->makeEmpty();
+  delete orig;
+  return res;
+}
+
 /**
  * Take an IntermediateNode, destroy it, and return
  * SListIntermediateNode with the same content.
@@ -235,12 +427,31 @@ SubstitutionTree::SListLeaf* SubstitutionTree::SListLeaf::assimilate(Leaf* orig)
   return res;
 }
 
+/**
+ * Take a Leaf, destroy it, and return SArrLeaf
+ * with the same content.
+ */
+SubstitutionTree::SArrLeaf* SubstitutionTree::SArrLeaf::assimilate(Leaf* orig)
+{
+  CALL("SubstitutionTree::SArrLeaf::assimilate");
+
+  SArrLeaf* res=new SArrLeaf(orig->term);
+  res->loadChildren(orig->allChildren());
+  orig->makeEmpty();
+  delete orig;
+  return res;
+}
+
 void SubstitutionTree::ensureLeafEfficiency(Leaf** leaf)
 {
   CALL("SubstitutionTree::ensureLeafEfficiency");
 
   if( (*leaf)->algorithm()==UNSORTED_LIST && (*leaf)->size()>5 ) {
-    *leaf=SListLeaf::assimilate(*leaf);
+    if(env.options->indexNodeLayout()==Shell::Options::IndexNodeLayout::SORTED_ARRAY) {
+      *leaf=SArrLeaf::assimilate(*leaf);
+    } else {
+      *leaf=SListLeaf::assimilate(*leaf);
+    }
   }
 }
 
@@ -249,7 +460,11 @@ void SubstitutionTree::ensureIntermediateNodeEfficiency(IntermediateNode** inode
   CALL("SubstitutionTree::ensureIntermediateNodeEfficiency");
 
   if( (*inode)->algorithm()==UNSORTED_LIST && (*inode)->size()>3 ) {
-    *inode=SListIntermediateNode::assimilate(*inode);
+    if(env.options->indexNodeLayout()==Shell::Options::IndexNodeLayout::SORTED_ARRAY) {
+      *inode=SArrIntermediateNode::assimilate(*inode);
+    } else {
+      *inode=SListIntermediateNode::assimilate(*inode);
+    }
   }
 }
 
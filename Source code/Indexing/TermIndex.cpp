@@ -44,31 +44,31 @@ TermIndex::~TermIndex()
 TermQueryResultIterator TermIndex::getUnifications(TermList t,
 	  bool retrieveSubstitutions)
 {
-  return _is->getUnifications(t, retrieveSubstitutions);
+  return skipSuspended(_is->getUnifications(t, retrieveSubstitutions));
 }
 
 TermQueryResultIterator TermIndex::getUnificationsWithConstraints(TermList t,
           bool retrieveSubstitutions)
 {
-  return _is->getUnificationsWithConstraints(t, retrieveSubstitutions);
+  return skipSuspended(_is->getUnificationsWithConstraints(t, retrieveSubstitutions));
 }
 
 TermQueryResultIterator TermIndex::getUnificationsUsingSorts(TermList t, TermList sort,
           bool retrieveSubstitutions)
 {
-  return _is->getUnificationsUsingSorts(t, sort, retrieveSubstitutions);
+  return skipSuspended(_is->getUnificationsUsingSorts(t, sort, retrieveSubstitutions));
 }
 
 TermQueryResultIterator TermIndex::getGeneralizations(TermList t,
 	  bool retrieveSubstitutions)
 {
-  return _is->getGeneralizations(t, retrieveSubstitutions);
+  return skipSuspended(_is->getGeneralizations(t, retrieveSubstitutions));
 }
 
 TermQueryResultIterator TermIndex::getInstances(TermList t,
 	  bool retrieveSubstitutions)
 {
-  return _is->getInstances(t, retrieveSubstitutions);
+  return skipSuspended(_is->getInstances(t, retrieveSubstitutions));
 }
 
 
@@ -164,6 +164,71 @@ void DemodulationSubtermIndexImpl<combinatorySupSupport>::handleClause(Clause* c
 template class DemodulationSubtermIndexImpl<false>;
 template class DemodulationSubtermIndexImpl<true>;
 
+DemodulationLHSIndex::~DemodulationLHSIndex()
+{
+  CALL("DemodulationLHSIndex::~DemodulationLHSIndex");
+
+  DHMap<Literal*, Comparators>::Iterator it(_comparators);
+  while (it.hasNext()) {
+    Comparators cmps = it.next();
+    delete cmps.sides[0];
+    delete cmps.sides[1];
+  }
+}
+
+/**
+ * Return the comparator deciding whether instances of the side @b lhs of the
+ * unorientable equation @b lit are greater than those of its other side, or
+ * 0 if there is none
+ */
+Ordering::InstanceComparator* DemodulationLHSIndex::instanceComparator(Literal* lit, TermList lhs)
+{
+  CALL("DemodulationLHSIndex::instanceComparator");
+
+  Comparators* cmps = _comparators.findPtr(lit);
+  if (!cmps) {
+    return 0;
+  }
+  return cmps->sides[lhs == *lit->nthArgument(0) ? 0 : 1];
+}
+
+/**
+ * Create the comparators of the unorientable equation @b lit when the first
+ * clause containing it is added, and delete them when the last one is removed
+ */
+void DemodulationLHSIndex::updateComparators(Literal* lit, bool adding)
+{
+  CALL("DemodulationLHSIndex::updateComparators");
+
+  if (!lit->isEquality() || lit->isNegative()) {
+    return;
+  }
+  Ordering::Result argOrder = _ord.getEqualityArgumentOrder(lit);
+  if (argOrder == Ordering::GREATER || argOrder == Ordering::LESS) {
+    return;
+  }
+
+  if (adding) {
+    Comparators* cmps;
+    if (_comparators.getValuePtr(lit, cmps)) {
+      TermList s = *lit->nthArgument(0);
+      TermList t = *lit->nthArgument(1);
+      cmps->sides[0] = _ord.createInstanceComparator(s, t);
+      cmps->sides[1] = _ord.createInstanceComparator(t, s);
+      cmps->clauses = 0;
+    }
+    cmps->clauses++;
+  }
+  else {
+    Comparators* cmps = _comparators.findPtr(lit);
+    if (cmps && !--cmps->clauses) {
+      delete cmps->sides[0];
+      delete cmps->sides[1];
+      _comparators.remove(lit);
+    }
+  }
+}
+
 void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
 {
   CALL("DemodulationLHSIndex::handleClause");
@@ -175,6 +240,9 @@ void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
   TimeCounter tc(TC_FORWARD_DEMODULATION_INDEX_MAINTENANCE);
 
   Literal* lit=(*c)[0];
+  if (_opt.forwardDemodulation() != Options::Demodulation::PREORDERED) {
+    updateComparators(lit, adding);
+  }
   TermIterator lhsi=EqHelper::getDemodulationLHSIterator(lit, true, _ord, _opt);
   while (lhsi.hasNext()) {
     if (adding) {
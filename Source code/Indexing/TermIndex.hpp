@@ -19,7 +19,9 @@
 #include "Index.hpp"
 
 #include "TermIndexingStructure.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Set.hpp"
+#include "Kernel/Ordering.hpp"
 
 namespace Indexing {
 
@@ -44,7 +46,7 @@ public:
 	  bool retrieveSubstitutions = true);
 
 protected:
-  TermIndex(TermIndexingStructure* is) : _is(is) {}
+  TermIndex(TermIndexingStructure* is) : _is(is) { _suspendable = true; }
 
   TermIndexingStructure* _is;
 };
@@ -121,11 +123,24 @@ public:
 
   DemodulationLHSIndex(TermIndexingStructure* is, Ordering& ord, const Options& opt)
   : TermIndex(is), _ord(ord), _opt(opt) {};
+  ~DemodulationLHSIndex();
+
+  Ordering::InstanceComparator* instanceComparator(Literal* lit, TermList lhs);
 protected:
   void handleClause(Clause* c, bool adding);
 private:
+  /** Comparators of an unorientable equation, one for each side as the greater one */
+  struct Comparators {
+    Ordering::InstanceComparator* sides[2];
+    /** number of indexed clauses containing the equation */
+    unsigned clauses;
+  };
+
+  void updateComparators(Literal* lit, bool adding);
+
   Ordering& _ord;
   const Options& _opt;
+  DHMap<Literal*, Comparators> _comparators;
 };
 
 /**
@@ -233,7 +248,10 @@ public:
   USE_ALLOCATOR(HeuristicInstantiationIndex);
 
   HeuristicInstantiationIndex(TermIndexingStructure* is) : TermIndex(is)
-  {}
+  {
+    // the entries are instantiations derived from the clause, not the clause's own terms
+    _suspendable = false;
+  }
 protected:
   void insertInstantiation(TermList sort, TermList instantiation);
   void handleClause(Clause* c, bool adding);
@@ -249,7 +267,10 @@ public:
   USE_ALLOCATOR(RenamingFormulaIndex);
 
   RenamingFormulaIndex(TermIndexingStructure* is) : TermIndex(is)
-  {}
+  {
+    // handleClause maintains the formula counts in the signature, which must follow the container
+    _suspendable = false;
+  }
   void insertFormula(TermList formula, TermList name, Literal* lit, Clause* cls);
 protected:
   void handleClause(Clause* c, bool adding);
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file FeatureVectorBackwardSubsumption.cpp
+ * Implements class FeatureVectorBackwardSubsumption.
+ */
+
+#include "Lib/Environment.hpp"
+#include "Lib/List.hpp"
+#include "Lib/Metaiterators.hpp"
+#include "Lib/Stack.hpp"
+#include "Lib/TimeCounter.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Indexing/FeatureVectorIndex.hpp"
+#include "Indexing/IndexManager.hpp"
+#include "Indexing/LiteralIndex.hpp"
+
+#include "Saturation/SaturationAlgorithm.hpp"
+
+#include "Shell/Statistics.hpp"
+
+#include "FeatureVectorBackwardSubsumption.hpp"
+
+namespace Inferences
+{
+
+using namespace Lib;
+using namespace Kernel;
+using namespace Indexing;
+using namespace Saturation;
+
+void FeatureVectorBackwardSubsumption::attach(SaturationAlgorithm* salg)
+{
+  CALL("FeatureVectorBackwardSubsumption::attach");
+  ASS(!_index);
+
+  BackwardSimplificationEngine::attach(salg);
+  if(!_byUnitsOnly) {
+    _index=static_cast<FeatureVectorIndex*>(
+	    _salg->getIndexManager()->request(BW_SUBSUMPTION_FEATURE_VECTOR_INDEX) );
+  }
+  _unitSubsumption=new SLQueryBackwardSubsumption(static_cast<SimplifyingLiteralIndex*>(
+	  _salg->getIndexManager()->request(SIMPLIFYING_SUBST_TREE) ), _byUnitsOnly);
+}
+
+void FeatureVectorBackwardSubsumption::detach()
+{
+  CALL("FeatureVectorBackwardSubsumption::detach");
+  if(!_byUnitsOnly) {
+    _index=0;
+    _salg->getIndexManager()->release(BW_SUBSUMPTION_FEATURE_VECTOR_INDEX);
+  }
+  _unitSubsumption=0;
+  _salg->getIndexManager()->release(SIMPLIFYING_SUBST_TREE);
+  BackwardSimplificationEngine::detach();
+}
+
+struct FeatureVectorBackwardSubsumption::ClauseToBwSimplRecordFn
+{
+  BwSimplificationRecord operator()(Clause* cl)
+  {
+    return BwSimplificationRecord(cl);
+  }
+};
+
+void FeatureVectorBackwardSubsumption::perform(Clause* cl,
+	BwSimplificationRecordIterator& simplifications)
+{
+  CALL("FeatureVectorBackwardSubsumption::perform");
+  ASSERT_VALID(*cl);
+
+  unsigned clen=cl->length();
+  if(clen<=1 || _byUnitsOnly) {
+    _unitSubsumption->perform(cl, simplifications);
+    return;
+  }
+
+  TimeCounter tc(TC_BACKWARD_SUBSUMPTION);
+
+  simplifications=BwSimplificationRecordIterator::getEmpty();
+
+  static Stack<Clause*> candidates;
+  candidates.reset();
+  _index->getPossiblySubsumed(cl, candidates);
+
+  ClauseList* subsumed=0;
+  Stack<Clause*>::Iterator cit(candidates);
+  while(cit.hasNext()) {
+    Clause* icl=cit.next();
+    if(icl==cl) {
+      continue;
+    }
+    if(SLQueryBackwardSubsumption::subsumes(cl,icl)) {
+      ClauseList::push(icl, subsumed);
+      env.statistics->backwardSubsumed++;
+    }
+  }
+
+  if(subsumed) {
+    simplifications=getPersistentIterator(
+	    getMappingIterator(ClauseList::Iterator(subsumed), ClauseToBwSimplRecordFn()));
+    ClauseList::destroy(subsumed);
+  }
+}
+
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file FeatureVectorBackwardSubsumption.hpp
+ * Defines class FeatureVectorBackwardSubsumption.
+ */
+
+
+#ifndef __FeatureVectorBackwardSubsumption__
+#define __FeatureVectorBackwardSubsumption__
+
+#include "Lib/ScopedPtr.hpp"
+
+#include "InferenceEngine.hpp"
+#include "SLQueryBackwardSubsumption.hpp"
+
+namespace Inferences {
+
+using namespace Indexing;
+
+/**
+ * Backward subsumption retrieving the candidate clauses from
+ * a FeatureVectorIndex rather than from a literal index
+ *
+ * Unit and empty clauses are still handled by SLQueryBackwardSubsumption,
+ * as a literal index retrieves the instances of a single literal directly,
+ * while the feature vector of a unit says little about its instances.
+ */
+class FeatureVectorBackwardSubsumption
+: public BackwardSimplificationEngine
+{
+public:
+  CLASS_NAME(FeatureVectorBackwardSubsumption);
+  USE_ALLOCATOR(FeatureVectorBackwardSubsumption);
+
+  FeatureVectorBackwardSubsumption(bool byUnitsOnly) : _byUnitsOnly(byUnitsOnly), _index(0) {}
+
+  /**
+   * Create FeatureVectorBackwardSubsumption rule with explicitely provided indices,
+   * independent of an SaturationAlgorithm.
+   *
+   * For objects created by this constructor, methods  @c attach()
+   * and @c detach() must not be called.
+   */
+  FeatureVectorBackwardSubsumption(FeatureVectorIndex* index, SimplifyingLiteralIndex* litIndex, bool byUnitsOnly=false)
+  : _byUnitsOnly(byUnitsOnly), _index(index), _unitSubsumption(new SLQueryBackwardSubsumption(litIndex, byUnitsOnly)) {}
+
+  void attach(SaturationAlgorithm* salg);
+  void detach();
+
+  void perform(Clause* premise, BwSimplificationRecordIterator& simplifications);
+private:
+  struct ClauseToBwSimplRecordFn;
+
+  bool _byUnitsOnly;
+  FeatureVectorIndex* _index;
+  /** performs the subsumption by unit and empty clauses */
+  ScopedPtr<SLQueryBackwardSubsumption> _unitSubsumption;
+};
+
+};
+
+#endif /* __FeatureVectorBackwardSubsumption__ */
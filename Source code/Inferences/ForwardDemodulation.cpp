@@ -165,8 +165,19 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
           }
         }
   #endif
-        if(!preordered && (_preorderedOnly || ordering.compare(trm,rhsS)!=Ordering::GREATER) ) {
-          continue;
+        if(!preordered) {
+          if(_preorderedOnly) {
+            continue;
+          }
+          // unless the substitution had to be normalized, the precompiled
+          // comparator of the index can decide the ordering for us
+          Ordering::InstanceComparator* cmp = 0;
+          if(!resultTermIsVar && qr.substitution->isIdentityOnQueryWhenResultBound()) {
+            cmp = _index->instanceComparator(qr.literal, qr.term);
+          }
+          if(cmp ? !cmp->isGreater(trm, rhsS, *qr.substitution) : ordering.compare(trm,rhsS)!=Ordering::GREATER) {
+            continue;
+          }
         }
 
         if(toplevelCheck) {
@@ -23,6 +23,7 @@
 #include "Kernel/Clause.hpp"
 #include "Kernel/Inference.hpp"
 #include "Kernel/Matcher.hpp"
+#include "Kernel/ClauseFeatures.hpp"
 #include "Kernel/MLMatcher.hpp"
 #include "Kernel/ColorHelper.hpp"
 
@@ -269,6 +270,12 @@ bool ForwardSubsumptionAndResolution::perform(Clause *cl, Clause *&replacement,
           continue;
         }
 
+        env.statistics->subsumptionFeatureChecks++;
+        if (!mcl->features().maySubsume(cl->features())) {
+          env.statistics->subsumptionFeatureRejections++;
+          continue;
+        }
+
         if (MLMatcher::canBeMatched(mcl, cl, cms->_matches, 0) && ColorHelper::compatible(cl->color(), mcl->color())) {
           premises = pvi(getSingletonIterator(mcl));
           env.statistics->forwardSubsumed++;
@@ -24,6 +24,7 @@
 
 #include "Kernel/Clause.hpp"
 #include "Kernel/Matcher.hpp"
+#include "Kernel/ClauseFeatures.hpp"
 #include "Kernel/MLMatcher.hpp"
 #include "Kernel/Signature.hpp"
 #include "Kernel/Term.hpp"
@@ -86,6 +87,48 @@ struct SLQueryBackwardSubsumption::ClauseToBwSimplRecordFn
 };
 
 
+/**
+ * Return true if @b cl subsumes @b icl. If @b matchedLit is non-zero, it is
+ * a literal of @b icl already known to be an instance of the literal of @b cl
+ * at @b matchedIndex.
+ */
+bool SLQueryBackwardSubsumption::subsumes(Clause* cl, Clause* icl, unsigned matchedIndex, Literal* matchedLit)
+{
+  CALL("SLQueryBackwardSubsumption::subsumes");
+
+  unsigned clen=cl->length();
+  unsigned ilen=icl->length();
+
+  static DArray<LiteralList*> matchedLits(32);
+  matchedLits.init(clen, 0);
+
+  bool res=false;
+  if(matchedLit) {
+    LiteralList::push(matchedLit, matchedLits[matchedIndex]);
+  }
+  for(unsigned bi=0;bi<clen;bi++) {
+    for(unsigned ii=0;ii<ilen;ii++) {
+      if(matchedLit && bi==matchedIndex && (*icl)[ii]==matchedLit) {
+	continue;
+      }
+      if(MatchingUtils::match((*cl)[bi],(*icl)[ii],false)) {
+	LiteralList::push((*icl)[ii], matchedLits[bi]);
+      }
+    }
+    if(!matchedLits[bi]) {
+      goto match_fail;
+    }
+  }
+  res=MLMatcher::canBeMatched(cl,icl,matchedLits.array(),0);
+
+match_fail:
+  for(unsigned bi=0; bi<clen; bi++) {
+    LiteralList::destroy(matchedLits[bi]);
+    matchedLits[bi]=0;
+  }
+  return res;
+}
+
 void SLQueryBackwardSubsumption::perform(Clause* cl,
 	BwSimplificationRecordIterator& simplifications)
 {
@@ -144,9 +187,6 @@ void SLQueryBackwardSubsumption::perform(Clause* cl,
     }
   }
 
-  static DArray<LiteralList*> matchedLits(32);
-  matchedLits.init(clen, 0);
-
   ClauseList* subsumed=0;
 
   static DHSet<unsigned> basePreds;
@@ -173,6 +213,12 @@ void SLQueryBackwardSubsumption::perform(Clause* cl,
 
     RSTAT_CTR_INC("bs1 0 candidates");
 
+    env.statistics->subsumptionFeatureChecks++;
+    if(!cl->features().maySubsume(icl->features())) {
+      env.statistics->subsumptionFeatureRejections++;
+      continue;
+    }
+
     //here we pick one literal header of the base clause and make sure that
     //every instance clause has it
     if(!mustPredInit) {
@@ -242,35 +288,11 @@ void SLQueryBackwardSubsumption::perform(Clause* cl,
 
     RSTAT_CTR_INC("bs1 2 survived");
 
-
-
-    LiteralList::push(qr.literal, matchedLits[lmIndex]);
-    for(unsigned bi=0;bi<clen;bi++) {
-      for(unsigned ii=0;ii<ilen;ii++) {
-	if(bi==lmIndex && (*icl)[ii]==qr.literal) {
-	  continue;
-	}
-	if(MatchingUtils::match((*cl)[bi],(*icl)[ii],false)) {
-	  LiteralList::push((*icl)[ii], matchedLits[bi]);
-	}
-      }
-      if(!matchedLits[bi]) {
-	goto match_fail;
-      }
-    }
-
-    RSTAT_CTR_INC("bs1 3 final check");
-    if(MLMatcher::canBeMatched(cl,icl,matchedLits.array(),0)) {
+    if(subsumes(cl,icl,lmIndex,qr.literal)) {
       ClauseList::push(icl, subsumed);
       env.statistics->backwardSubsumed++;
       RSTAT_CTR_INC("bs1 4 performed");
     }
-
-  match_fail:
-    for(unsigned bi=0; bi<clen; bi++) {
-      LiteralList::destroy(matchedLits[bi]);
-      matchedLits[bi]=0;
-    }
   }
 
 
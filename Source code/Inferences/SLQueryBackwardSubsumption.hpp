@@ -44,6 +44,8 @@ public:
   void detach();
 
   void perform(Clause* premise, BwSimplificationRecordIterator& simplifications);
+
+  static bool subsumes(Clause* cl, Clause* icl, unsigned matchedIndex=0, Literal* matchedLit=0);
 private:
   struct ClauseExtractorFn;
   struct ClauseToBwSimplRecordFn;
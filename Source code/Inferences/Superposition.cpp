@@ -14,6 +14,7 @@
 
 #include "Debug/RuntimeStatistics.hpp"
 
+#include "Lib/DArray.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
 #include "Lib/Metaiterators.hpp"
@@ -32,6 +33,7 @@
 #include "Kernel/Unit.hpp"
 #include "Kernel/LiteralSelector.hpp"
 #include "Kernel/RobSubstitution.hpp"
+#include "Kernel/SubstHelper.hpp"
 
 #include "Indexing/Index.hpp"
 #include "Indexing/IndexManager.hpp"
@@ -65,6 +67,20 @@ void Superposition::attach(SaturationAlgorithm* salg)
 	  _salg->getIndexManager()->request(SUPERPOSITION_SUBTERM_SUBST_TREE) );
   _lhsIndex=static_cast<SuperpositionLHSIndex*> (
 	  _salg->getIndexManager()->request(SUPERPOSITION_LHS_SUBST_TREE) );
+
+  // Deferred literals are built when Discount selects the clause, so nothing
+  // may need to look at them before that.
+  const Options& opt = getOptions();
+  _deferLiterals = opt.lazyPassive() &&
+      opt.saturationAlgorithm()==Options::SaturationAlgorithm::DISCOUNT &&
+      !opt.splitting() && !opt.usePositiveLiteralSplitQueues() &&
+      !opt.showPassive() && !opt.showNew() && !opt.showSymbolElimination() &&
+      !opt.nonliteralsInClauseWeight() && !opt.increasedNumeralWeight() && !opt.restrictNWCtoGC() &&
+      opt.proofExtra()!=Options::ProofExtra::FULL &&
+      opt.mode()!=Options::Mode::CONSEQUENCE_ELIMINATION &&
+      opt.questionAnswering()==Options::QuestionAnsweringMode::OFF &&
+      opt.checkpointFile().empty() &&
+      !env.property->higherOrder() && !env.property->hasPolymorphicSym();
 }
 
 void Superposition::detach()
@@ -80,6 +96,140 @@ void Superposition::detach()
 
 
 
+/**
+ * Side literals of a superposition conclusion, kept as the literals of the
+ * premises together with the bindings the unifier gave to their variables
+ *
+ * Used for clauses that wait in the passive container, most of which are
+ * never selected, so that the side literals of those are never built.
+ *
+ * With simultaneous superposition the rewritten term is also replaced in
+ * the side literals of the rewritten clause, which weight() ignores.
+ *
+ * This is not a compact representation of the passive clause: the Clause
+ * object, its literal array and its Inference are still allocated, and the
+ * rewritten literal is built for the passive ordering. What is saved are the
+ * shared side literals and the simplifications. Conclusions of other
+ * inferences are built as usual.
+ */
+class Superposition::DeferredLiterals
+: public Clause::DeferredLiterals
+{
+public:
+  CLASS_NAME(Superposition::DeferredLiterals);
+  USE_ALLOCATOR(Superposition::DeferredLiterals);
+
+  DeferredLiterals(Clause* rwClause, Literal* rwLit, Clause* eqClause, Literal* eqLit,
+      ResultSubstitutionSP subst, bool eqIsResult, TermList rwTermS, TermList tgtTermS, bool simultaneous)
+  : _rwClause(rwClause), _rwLit(rwLit), _eqClause(eqClause), _eqLit(eqLit),
+    _rwTermS(rwTermS), _tgtTermS(tgtTermS), _simultaneous(simultaneous)
+  {
+    recordBindings(_rwClause, _rwLit, subst, !eqIsResult, _rwBindings);
+    recordBindings(_eqClause, _eqLit, subst, eqIsResult, _eqBindings);
+  }
+
+  /** Return the total weight of the side literals once they are built */
+  unsigned weight() const
+  {
+    return sideWeight(_rwClause, _rwLit, _rwBindings) + sideWeight(_eqClause, _eqLit, _eqBindings);
+  }
+
+  bool build(Clause* cl) override
+  {
+    CALL("Superposition::DeferredLiterals::build");
+
+    bool res = true;
+    unsigned next = 1;
+    buildSide(cl, next, _rwClause, _rwLit, _rwBindings, _simultaneous, res);
+    buildSide(cl, next, _eqClause, _eqLit, _eqBindings, false, res);
+    ASS_EQ(next, cl->length());
+    return res;
+  }
+
+private:
+  struct Applicator
+  {
+    Applicator(const DArray<TermList>& bindings) : _bindings(bindings) {}
+    TermList apply(unsigned var) { return _bindings[var]; }
+    const DArray<TermList>& _bindings;
+  };
+
+  static void recordBindings(Clause* cl, Literal* skipped, ResultSubstitutionSP subst, bool result,
+      DArray<TermList>& bindings)
+  {
+    CALL("Superposition::DeferredLiterals::recordBindings");
+
+    unsigned varCnt = 0;
+    for (unsigned i = 0; i < cl->length(); i++) {
+      if ((*cl)[i] == skipped) {
+        continue;
+      }
+      VariableIterator vit((*cl)[i]);
+      while (vit.hasNext()) {
+        varCnt = Int::max(varCnt, vit.next().var()+1);
+      }
+    }
+    bindings.expand(varCnt);
+    for (unsigned v = 0; v < varCnt; v++) {
+      // variables not occurring in the side literals get an unused binding
+      bindings[v] = subst->apply(TermList(v, false), result);
+    }
+  }
+
+  /**
+   * The weight of an instance is the weight of the literal plus, for every
+   * variable occurrence, the weight the binding adds over the variable itself.
+   */
+  static unsigned sideWeight(Clause* cl, Literal* skipped, const DArray<TermList>& bindings)
+  {
+    CALL("Superposition::DeferredLiterals::sideWeight");
+
+    unsigned res = 0;
+    for (unsigned i = 0; i < cl->length(); i++) {
+      Literal* curr = (*cl)[i];
+      if (curr == skipped) {
+        continue;
+      }
+      res += curr->weight();
+      VariableIterator vit(curr);
+      while (vit.hasNext()) {
+        res += bindings[vit.next().var()].weight() - 1;
+      }
+    }
+    return res;
+  }
+
+  void buildSide(Clause* res, unsigned& next, Clause* cl, Literal* skipped,
+      const DArray<TermList>& bindings, bool replace, bool& valid)
+  {
+    Applicator app(bindings);
+    for (unsigned i = 0; i < cl->length(); i++) {
+      Literal* curr = (*cl)[i];
+      if (curr == skipped) {
+        continue;
+      }
+      Literal* currAfter = SubstHelper::apply(curr, app);
+      if (replace) {
+        currAfter = EqHelper::replace(currAfter, _rwTermS, _tgtTermS);
+      }
+      if (EqHelper::isEqTautology(currAfter)) {
+        valid = false;
+      }
+      (*res)[next++] = currAfter;
+    }
+  }
+
+  Clause* _rwClause;
+  Literal* _rwLit;
+  Clause* _eqClause;
+  Literal* _eqLit;
+  TermList _rwTermS;
+  TermList _tgtTermS;
+  bool _simultaneous;
+  DArray<TermList> _rwBindings;
+  DArray<TermList> _eqBindings;
+};
+
 struct Superposition::RewritableResultsFn
 {
   RewritableResultsFn(SuperpositionSubtermIndex* index,bool wc,bool ea) : _index(index),
@@ -375,6 +525,28 @@ bool Superposition::earlyWeightLimitCheck(Clause* eqClause, Literal* eqLit,
   return true;
 }
 
+void Superposition::updateStatistics(Clause* rwClause, Clause* eqClause, bool eqIsResult, bool hasConstraints)
+{
+  //TODO update AYB
+  if(!hasConstraints){
+    if(rwClause==eqClause) {
+      env.statistics->selfSuperposition++;
+    } else if(eqIsResult) {
+      env.statistics->forwardSuperposition++;
+    } else {
+      env.statistics->backwardSuperposition++;
+    }
+  } else {
+    if(rwClause==eqClause) {
+      env.statistics->cSelfSuperposition++;
+    } else if(eqIsResult) {
+      env.statistics->cForwardSuperposition++;
+    } else {
+      env.statistics->cBackwardSuperposition++;
+    }
+  }
+}
+
 /**
  * If superposition should be performed, return result of the superposition,
  * otherwise return 0.
@@ -506,6 +678,18 @@ Clause* Superposition::performSuperposition(
 
   static bool afterCheck = getOptions().literalMaximalityAftercheck() && _salg->getLiteralSelector().isBGComplete();
 
+  if (_deferLiterals && newLength > 1 && !hasConstraints && !isTypeSub && !afterCheck && !needsToFulfilWeightLimit) {
+    DeferredLiterals* lits = new DeferredLiterals(rwClause, rwLit, eqClause, eqLit, subst, eqIsResult,
+        rwTermS, tgtTermS, doSimS);
+    inf_destroyer.disable(); // ownership passed to the the clause below
+    Clause* res = new(newLength) Clause(newLength, inf);
+    (*res)[0] = tgtLitS;
+    res->deferLiterals(lits, tgtLitS->weight() + lits->weight());
+    env.statistics->deferredClauses++;
+    updateStatistics(rwClause, eqClause, eqIsResult, false);
+    return res;
+  }
+
   inf_destroyer.disable(); // ownership passed to the the clause below
   Clause* res = new(newLength) Clause(newLength, inf);
 
@@ -664,24 +848,7 @@ Clause* Superposition::performSuperposition(
     return 0;
   }
 
-  //TODO update AYB
-  if(!hasConstraints){
-    if(rwClause==eqClause) {
-      env.statistics->selfSuperposition++;
-    } else if(eqIsResult) {
-      env.statistics->forwardSuperposition++;
-    } else {
-      env.statistics->backwardSuperposition++;
-    }
-  } else {
-    if(rwClause==eqClause) {
-      env.statistics->cSelfSuperposition++;
-    } else if(eqIsResult) {
-      env.statistics->cForwardSuperposition++;
-    } else {
-      env.statistics->cBackwardSuperposition++;
-    }
-  }
+  updateStatistics(rwClause, eqClause, eqIsResult, hasConstraints);
 
 /*
   if(hasConstraints){ 
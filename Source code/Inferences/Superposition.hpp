@@ -54,6 +54,10 @@ private:
 
   static bool checkSuperpositionFromVariable(Clause* eqClause, Literal* eqLit, TermList eqLHS);
 
+  static void updateStatistics(Clause* rwClause, Clause* eqClause, bool eqIsResult, bool hasConstraints);
+
+  class DeferredLiterals;
+
   struct ForwardResultFn;
   struct RewriteableSubtermsFn;
   struct ApplicableRewritesFn;
@@ -64,6 +68,8 @@ private:
 
   SuperpositionSubtermIndex* _subtermIndex;
   SuperpositionLHSIndex* _lhsIndex;
+  /** build only the rewritten literal of conclusions, see DeferredLiterals */
+  bool _deferLiterals;
 };
 
 
@@ -34,6 +34,7 @@
 #include "Indexing/LiteralIndex.hpp"
 
 #include "SAT/SATClause.hpp"
+#include "SAT/CDCLSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
@@ -86,6 +87,9 @@ IGAlgorithm::IGAlgorithm(Problem& prb,const Options& opt)
     case Options::SatSolver::MINISAT:
       _satSolver = new MinisatInterfacing(opt,true);
       break;
+    case Options::SatSolver::CDCL:
+      _satSolver = new CDCLSolver(opt,true);
+      break;
 #if VZ3
     case Options::SatSolver::Z3:
       //cout << "Warning: Z3 not compatible with inst_gen, using Minisat" << endl;
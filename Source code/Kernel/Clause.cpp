@@ -33,6 +33,7 @@
 
 #include "Shell/Options.hpp"
 
+#include "ClauseFeatures.hpp"
 #include "Inference.hpp"
 #include "Signature.hpp"
 #include "Term.hpp"
@@ -73,6 +74,8 @@ Clause::Clause(unsigned length,const Inference& inf)
     _refCnt(0),
     _reductionTimestamp(0),
     _literalPositions(0),
+    _features(0),
+    _deferredLiterals(0),
     _numActiveSplits(0),
     _auxTimestamp(0)
 {
@@ -124,6 +127,12 @@ void Clause::destroyExceptInferenceObject()
   if (_literalPositions) {
     delete _literalPositions;
   }
+  if (_features) {
+    delete _features;
+  }
+  if (_deferredLiterals) {
+    delete _deferredLiterals;
+  }
 
   RSTAT_CTR_INC("clauses deleted");
 
@@ -338,6 +347,9 @@ vstring Clause::literalsOnlyToString() const
   } else {
     vstring result;
     result += _literals[0]->toString();
+    if (_deferredLiterals) {
+      return result + " | ...";
+    }
     for(unsigned i = 1; i < _length; i++) {
       result += " | ";
       result += _literals[i]->toString();
@@ -548,7 +560,7 @@ unsigned Clause::getNumeralWeight() const {
       IntegerConstantType intVal;
 
       if (theory->tryInterpretConstant(t, intVal)) {
-        int w = BitUtils::log2(Int::safeAbs(intVal.toInner())) - 1;
+        int w = intVal.log2Abs() - 1;
         if (w > 0) {
           res += w;
         }
@@ -567,8 +579,8 @@ unsigned Clause::getNumeralWeight() const {
       if (!haveRat) {
         continue;
       }
-      int wN = BitUtils::log2(Int::safeAbs(ratVal.numerator().toInner())) - 1;
-      int wD = BitUtils::log2(Int::safeAbs(ratVal.denominator().toInner())) - 1;
+      int wN = ratVal.numerator().log2Abs() - 1;
+      int wD = ratVal.denominator().log2Abs() - 1;
       int v = wN + wD;
       if (v > 0) {
         res += v;
@@ -748,6 +760,59 @@ unsigned Clause::getLiteralPosition(Literal* lit)
   }
 }
 
+/**
+ * Return the feature vector of the clause, computing it on the first call
+ */
+const ClauseFeatures& Clause::features()
+{
+  CALL("Clause::features");
+
+  if (!_features) {
+    _features = new ClauseFeatures(this);
+  }
+  return *_features;
+}
+
+/**
+ * Postpone building all literals but the first one until
+ * buildDeferredLiterals() is called. The clause takes ownership of @b lits.
+ *
+ * @b weight is (an estimate of) the weight the clause will have once the
+ * literals are built, so that the clause can be put into the passive
+ * container before that.
+ */
+void Clause::deferLiterals(DeferredLiterals* lits, unsigned weight)
+{
+  CALL("Clause::deferLiterals");
+  ASS(!_deferredLiterals);
+  ASS_EQ(_weight, 0);
+
+  _deferredLiterals = lits;
+  _weight = weight;
+  for (unsigned i = 1; i < _length; i++) {
+    _literals[i] = 0;
+  }
+}
+
+/**
+ * Build the literals postponed by deferLiterals(). All literals are
+ * present afterwards, but if false is returned, the clause is redundant
+ * and should be discarded.
+ */
+bool Clause::buildDeferredLiterals()
+{
+  CALL("Clause::buildDeferredLiterals");
+  ASS(_deferredLiterals);
+
+  bool res = _deferredLiterals->build(this);
+  delete _deferredLiterals;
+  _deferredLiterals = 0;
+  // the clause has left the passive container, so the estimate can be replaced
+  _weight = computeWeight();
+  _weightForClauseSelection = 0;
+  return res;
+}
+
 /**
  * This method should be called when literals of the clause are
  * reordered (e.g. after literal selection), so that the information
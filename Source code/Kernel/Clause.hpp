@@ -357,6 +357,28 @@ public:
 
   unsigned numPositiveLiterals(); // number of positive literals in the clause
 
+  const ClauseFeatures& features();
+
+  /**
+   * Recipe for the literals of a clause that were not built when the clause
+   * was created, see Clause::deferLiterals
+   */
+  class DeferredLiterals
+  {
+  public:
+    virtual ~DeferredLiterals() {}
+    /**
+     * Store the missing literals into @b cl. Return false if the clause
+     * turned out to contain an equational tautology.
+     */
+    virtual bool build(Clause* cl) = 0;
+  };
+
+  void deferLiterals(DeferredLiterals* lits, unsigned weight);
+  bool buildDeferredLiterals();
+  /** True if some literals of the clause have not been built yet */
+  bool hasDeferredLiterals() const { return _deferredLiterals; }
+
 protected:
   /** number of literals */
   unsigned _length : 20;
@@ -387,6 +409,10 @@ protected:
   unsigned _reductionTimestamp;
   /** a map that translates Literal* to its index in the clause */
   InverseLookup<Literal>* _literalPositions;
+  /** feature vector for subsumption, or 0 if not computed yet */
+  ClauseFeatures* _features;
+  /** literals still to be built, or 0 if all literals are present */
+  DeferredLiterals* _deferredLiterals;
 
   int _numActiveSplits;
 
@@ -0,0 +1,407 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseBucketQueue.cpp
+ * Implements class ClauseBucketQueue.
+ */
+
+#include "Shell/Options.hpp"
+
+#include "Clause.hpp"
+
+#include "ClauseBucketQueue.hpp"
+
+namespace Kernel
+{
+
+/**
+ * True if @b c1 precedes @b c2 among clauses of the same age and weight.
+ * Conjectures go before axioms and older clauses before newer ones.
+ */
+bool ClauseBucketQueue::before(Clause* c1, Clause* c2)
+{
+  if (c1->inputType() != c2->inputType()) {
+    return c2->inputType() < c1->inputType();
+  }
+  return c1->number() < c2->number();
+}
+
+void ClauseBucketQueue::Bucket::insert(Clause* cl)
+{
+  CALL("ClauseBucketQueue::Bucket::insert");
+
+  if (isEmpty()) {
+    clauses.reset();
+    first = 0;
+    clauses.push(cl);
+    return;
+  }
+  if (before(clauses.top(), cl)) {
+    clauses.push(cl);
+    return;
+  }
+  if (first>0 && before(cl, clauses[first])) {
+    clauses[--first] = cl;
+    return;
+  }
+  // find the first clause that goes after cl and shift the rest
+  unsigned lo = first;
+  unsigned hi = clauses.size()-1;
+  while (lo<hi) {
+    unsigned mid = (lo+hi)/2;
+    if (before(clauses[mid], cl)) {
+      lo = mid+1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  clauses.push(0);
+  for (unsigned i=clauses.size()-1; i>lo; i--) {
+    clauses[i] = clauses[i-1];
+  }
+  clauses[lo] = cl;
+}
+
+bool ClauseBucketQueue::Bucket::remove(Clause* cl)
+{
+  CALL("ClauseBucketQueue::Bucket::remove");
+
+  if (isEmpty()) {
+    return false;
+  }
+  if (clauses[first]==cl) {
+    pop();
+    return true;
+  }
+  unsigned lo = first;
+  unsigned hi = clauses.size();
+  while (lo<hi) {
+    unsigned mid = (lo+hi)/2;
+    if (before(clauses[mid], cl)) {
+      lo = mid+1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  if (lo==clauses.size() || clauses[lo]!=cl) {
+    return false;
+  }
+  for (unsigned i=lo; i+1<clauses.size(); i++) {
+    clauses[i] = clauses[i+1];
+  }
+  clauses.pop();
+  return true;
+}
+
+Clause* ClauseBucketQueue::Bucket::pop()
+{
+  CALL("ClauseBucketQueue::Bucket::pop");
+  ASS(!isEmpty());
+
+  Clause* res = clauses[first++];
+  if (isEmpty()) {
+    clauses.reset();
+    first = 0;
+  }
+  else if (first>=32 && 2*first>=clauses.size()) {
+    // move the remaining clauses to the beginning so that the array does not grow
+    unsigned sz = clauses.size()-first;
+    for (unsigned i=0; i<sz; i++) {
+      clauses[i] = clauses[first+i];
+    }
+    clauses.truncate(sz);
+    first = 0;
+  }
+  return res;
+}
+
+/**
+ * Return the index of the first clause going after @b last, or of the
+ * first clause if @b last is zero. The clause @b last was at @b index
+ * unless the bucket changed since.
+ */
+unsigned ClauseBucketQueue::Bucket::nextAfter(unsigned index, Clause* last) const
+{
+  CALL("ClauseBucketQueue::Bucket::nextAfter");
+
+  if (!last) {
+    return first;
+  }
+  if (index>=first && index<clauses.size() && clauses[index]==last) {
+    return index+1;
+  }
+  if (index>first && index<=clauses.size() && clauses[index-1]==last) {
+    return index;
+  }
+  unsigned lo = first;
+  unsigned hi = clauses.size();
+  while (lo<hi) {
+    unsigned mid = (lo+hi)/2;
+    if (before(last, clauses[mid])) {
+      hi = mid;
+    }
+    else {
+      lo = mid+1;
+    }
+  }
+  return lo;
+}
+
+ClauseBucketQueue::Row::~Row()
+{
+  Stack<Bucket*>::Iterator bit(buckets);
+  while (bit.hasNext()) {
+    Bucket* b = bit.next();
+    if (b) {
+      delete b;
+    }
+  }
+}
+
+ClauseBucketQueue::ClauseBucketQueue(const Shell::Options& opt)
+: _opt(opt), _minAge(0), _minWeight(0), _size(0)
+{
+}
+
+ClauseBucketQueue::~ClauseBucketQueue()
+{
+  CALL("ClauseBucketQueue::~ClauseBucketQueue");
+
+  Stack<Row*>::Iterator rit(_rows);
+  while (rit.hasNext()) {
+    Row* r = rit.next();
+    if (r) {
+      delete r;
+    }
+  }
+}
+
+ClauseBucketQueue::Bucket* ClauseBucketQueue::findBucket(unsigned age, unsigned weight) const
+{
+  if (age>=_rows.size() || !_rows[age]) {
+    return 0;
+  }
+  Row* r = _rows[age];
+  if (weight>=r->buckets.size()) {
+    return 0;
+  }
+  return r->buckets[weight];
+}
+
+ClauseBucketQueue::Bucket* ClauseBucketQueue::getBucket(unsigned age, unsigned weight, bool create)
+{
+  CALL("ClauseBucketQueue::getBucket");
+
+  Bucket* res = findBucket(age, weight);
+  if (res || !create) {
+    return res;
+  }
+  while (_rows.size()<=age) {
+    _rows.push(0);
+  }
+  if (!_rows[age]) {
+    _rows[age] = new Row();
+  }
+  Row* r = _rows[age];
+  while (r->buckets.size()<=weight) {
+    r->buckets.push(0);
+  }
+  res = new Bucket();
+  r->buckets[weight] = res;
+  return res;
+}
+
+void ClauseBucketQueue::insert(Clause* cl)
+{
+  CALL("ClauseBucketQueue::insert");
+
+  unsigned age = cl->age();
+  unsigned weight = cl->weightForClauseSelection(_opt);
+  getBucket(age, weight, true)->insert(cl);
+
+  Row* r = _rows[age];
+  r->size++;
+  r->minWeight = min(r->minWeight, weight);
+  while (_weightCounts.size()<=weight) {
+    _weightCounts.push(0);
+  }
+  _weightCounts[weight]++;
+  _minAge = min(_minAge, age);
+  _minWeight = min(_minWeight, weight);
+  _size++;
+}
+
+/**
+ * Update the counters after a clause was removed from the bucket
+ * (@b age, @b weight) and release the bucket and its row if they are empty
+ */
+void ClauseBucketQueue::onRemoved(unsigned age, unsigned weight)
+{
+  CALL("ClauseBucketQueue::onRemoved");
+
+  Row* r = _rows[age];
+  if (r->buckets[weight]->isEmpty()) {
+    delete r->buckets[weight];
+    r->buckets[weight] = 0;
+    while (r->buckets.isNonEmpty() && !r->buckets.top()) {
+      r->buckets.pop();
+    }
+  }
+  if (--r->size==0) {
+    delete r;
+    _rows[age] = 0;
+    while (_rows.isNonEmpty() && !_rows.top()) {
+      _rows.pop();
+    }
+  }
+  if (--_weightCounts[weight]==0) {
+    while (_weightCounts.isNonEmpty() && !_weightCounts.top()) {
+      _weightCounts.pop();
+    }
+  }
+  _size--;
+}
+
+bool ClauseBucketQueue::remove(Clause* cl)
+{
+  CALL("ClauseBucketQueue::remove");
+
+  unsigned age = cl->age();
+  unsigned weight = cl->weightForClauseSelection(_opt);
+  Bucket* b = findBucket(age, weight);
+  if (!b || !b->remove(cl)) {
+    return false;
+  }
+  onRemoved(age, weight);
+  return true;
+}
+
+/**
+ * Remove and return the first clause in the age order
+ */
+Clause* ClauseBucketQueue::popByAge()
+{
+  CALL("ClauseBucketQueue::popByAge");
+  ASS(!isEmpty());
+
+  while (!_rows[_minAge] || _rows[_minAge]->size==0) {
+    _minAge++;
+  }
+  Row* r = _rows[_minAge];
+  while (!r->buckets[r->minWeight] || r->buckets[r->minWeight]->isEmpty()) {
+    r->minWeight++;
+  }
+  Clause* res = r->buckets[r->minWeight]->pop();
+  onRemoved(_minAge, r->minWeight);
+  return res;
+}
+
+/**
+ * Remove and return the first clause in the weight order
+ */
+Clause* ClauseBucketQueue::popByWeight()
+{
+  CALL("ClauseBucketQueue::popByWeight");
+  ASS(!isEmpty());
+
+  while (_weightCounts[_minWeight]==0) {
+    _minWeight++;
+  }
+  for (unsigned age=_minAge; ; age++) {
+    ASS_L(age, _rows.size());
+    Bucket* b = findBucket(age, _minWeight);
+    if (b && !b->isEmpty()) {
+      Clause* res = b->pop();
+      onRemoved(age, _minWeight);
+      return res;
+    }
+  }
+}
+
+ClauseBucketQueue::AgeIterator::AgeIterator(const ClauseBucketQueue& queue)
+: _queue(queue), _age(queue._minAge), _weight(0), _index(0), _last(0)
+{
+}
+
+bool ClauseBucketQueue::AgeIterator::hasNext()
+{
+  CALL("ClauseBucketQueue::AgeIterator::hasNext");
+
+  while (_age<_queue._rows.size()) {
+    Row* r = _queue._rows[_age];
+    if (!r || _weight>=r->buckets.size()) {
+      _age++;
+      _weight = 0;
+      _last = 0;
+      continue;
+    }
+    Bucket* b = r->buckets[_weight];
+    if (b) {
+      _index = b->nextAfter(_index, _last);
+      if (_index<b->clauses.size()) {
+        return true;
+      }
+    }
+    _weight++;
+    _last = 0;
+  }
+  return false;
+}
+
+Clause* ClauseBucketQueue::AgeIterator::next()
+{
+  CALL("ClauseBucketQueue::AgeIterator::next");
+  ALWAYS(hasNext());
+
+  _last = _queue._rows[_age]->buckets[_weight]->clauses[_index];
+  return _last;
+}
+
+ClauseBucketQueue::WeightIterator::WeightIterator(const ClauseBucketQueue& queue)
+: _queue(queue), _weight(queue._minWeight), _age(queue._minAge), _index(0), _last(0)
+{
+}
+
+bool ClauseBucketQueue::WeightIterator::hasNext()
+{
+  CALL("ClauseBucketQueue::WeightIterator::hasNext");
+
+  while (_weight<_queue._weightCounts.size()) {
+    if (_queue._weightCounts[_weight]==0 || _age>=_queue._rows.size()) {
+      _weight++;
+      _age = _queue._minAge;
+      _last = 0;
+      continue;
+    }
+    Bucket* b = _queue.findBucket(_age, _weight);
+    if (b) {
+      _index = b->nextAfter(_index, _last);
+      if (_index<b->clauses.size()) {
+        return true;
+      }
+    }
+    _age++;
+    _last = 0;
+  }
+  return false;
+}
+
+Clause* ClauseBucketQueue::WeightIterator::next()
+{
+  CALL("ClauseBucketQueue::WeightIterator::next");
+  ALWAYS(hasNext());
+
+  _last = _queue.findBucket(_age, _weight)->clauses[_index];
+  return _last;
+}
+
+}
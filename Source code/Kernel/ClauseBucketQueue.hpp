@@ -0,0 +1,157 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseBucketQueue.hpp
+ * Defines class ClauseBucketQueue.
+ */
+
+#ifndef __ClauseBucketQueue__
+#define __ClauseBucketQueue__
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Reflection.hpp"
+#include "Lib/Stack.hpp"
+
+namespace Kernel {
+
+using namespace Lib;
+
+/**
+ * A queue of clauses that can be popped both in the age order
+ * (age, weight, input type, number) and in the weight order
+ * (weight, age, input type, number), where weight stands for the weight
+ * for clause selection. These are the orders of AgeQueue and WeightQueue.
+ *
+ * Ages and weights are small numbers, so the clauses are kept in a grid of
+ * buckets indexed by age and weight. A bucket is an array ordered by input
+ * type and number, which is mostly filled at its end since newer clauses
+ * have larger numbers. Locating a bucket takes constant time and the
+ * smallest non-empty row and column are found by cursors that only move
+ * forward between insertions of smaller clauses.
+ *
+ * Both orders share the buckets, so every clause is stored only once.
+ * Empty buckets and rows are freed and the arrays pointing to them are
+ * trimmed, so besides the clauses the queue only takes memory linear in
+ * the largest age and weight of a clause it contains.
+ *
+ * The iterators stay valid when clauses are removed from the queue, they
+ * continue after the last clause they returned.
+ */
+class ClauseBucketQueue
+{
+public:
+  CLASS_NAME(ClauseBucketQueue);
+  USE_ALLOCATOR(ClauseBucketQueue);
+
+  explicit ClauseBucketQueue(const Shell::Options& opt);
+  ~ClauseBucketQueue();
+
+  void insert(Clause* cl);
+  bool remove(Clause* cl);
+  Clause* popByAge();
+  Clause* popByWeight();
+
+  /** True if the queue is empty */
+  bool isEmpty() const { return _size==0; }
+  unsigned size() const { return _size; }
+
+private:
+  struct Bucket
+  {
+    CLASS_NAME(ClauseBucketQueue::Bucket);
+    USE_ALLOCATOR(ClauseBucketQueue::Bucket);
+
+    Bucket() : first(0) {}
+
+    bool isEmpty() const { return first==clauses.size(); }
+    void insert(Clause* cl);
+    bool remove(Clause* cl);
+    Clause* pop();
+    unsigned nextAfter(unsigned index, Clause* last) const;
+
+    /** clauses ordered by input type and number, valid from index first */
+    Stack<Clause*> clauses;
+    unsigned first;
+  };
+
+  struct Row
+  {
+    CLASS_NAME(ClauseBucketQueue::Row);
+    USE_ALLOCATOR(ClauseBucketQueue::Row);
+
+    Row() : size(0), minWeight(0) {}
+    ~Row();
+
+    /** buckets indexed by weight, zero if empty */
+    Stack<Bucket*> buckets;
+    /** number of clauses in the row */
+    unsigned size;
+    /** no bucket with a smaller weight is non-empty */
+    unsigned minWeight;
+  };
+
+  static bool before(Clause* c1, Clause* c2);
+  Bucket* getBucket(unsigned age, unsigned weight, bool create);
+  Bucket* findBucket(unsigned age, unsigned weight) const;
+  void onRemoved(unsigned age, unsigned weight);
+
+  const Shell::Options& _opt;
+
+  /** rows indexed by age, zero if empty */
+  Stack<Row*> _rows;
+  /** number of clauses of each weight */
+  Stack<unsigned> _weightCounts;
+  /** no row with a smaller age is non-empty */
+  unsigned _minAge;
+  /** there is no clause with a smaller weight */
+  unsigned _minWeight;
+  unsigned _size;
+
+public:
+  /** Iterator over the queue in the age order */
+  class AgeIterator {
+  public:
+    DECL_ELEMENT_TYPE(Clause*);
+
+    explicit AgeIterator(const ClauseBucketQueue& queue);
+    bool hasNext();
+    Clause* next();
+  private:
+    const ClauseBucketQueue& _queue;
+    unsigned _age;
+    unsigned _weight;
+    unsigned _index;
+    /** the clause returned last from the current bucket, or zero */
+    Clause* _last;
+  };
+
+  /** Iterator over the queue in the weight order */
+  class WeightIterator {
+  public:
+    DECL_ELEMENT_TYPE(Clause*);
+
+    explicit WeightIterator(const ClauseBucketQueue& queue);
+    bool hasNext();
+    Clause* next();
+  private:
+    const ClauseBucketQueue& _queue;
+    unsigned _weight;
+    unsigned _age;
+    unsigned _index;
+    /** the clause returned last from the current bucket, or zero */
+    Clause* _last;
+  };
+};
+
+}
+
+#endif // __ClauseBucketQueue__
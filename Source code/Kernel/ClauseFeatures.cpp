@@ -0,0 +1,91 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseFeatures.cpp
+ * Implements class ClauseFeatures.
+ */
+
+#include "Lib/Stack.hpp"
+
+#include "Clause.hpp"
+#include "Term.hpp"
+
+#include "ClauseFeatures.hpp"
+
+namespace Kernel
+{
+
+using namespace Lib;
+
+ClauseFeatures::ClauseFeatures(Clause* cl)
+{
+  CALL("ClauseFeatures::ClauseFeatures");
+
+  for(unsigned i=0;i<WORDS;i++) {
+    _words[i] = 0;
+  }
+
+  unsigned clen = cl->length();
+  for(unsigned i=0;i<clen;i++) {
+    Literal* lit = (*cl)[i];
+    increment(LENGTH);
+    increment(lit->isPositive() ? POSITIVE : NEGATIVE);
+    increment(PREDICATES + lit->header() % (FUNCTIONS - PREDICATES));
+    raise(DEPTH, addTerms(lit));
+  }
+}
+
+/**
+ * Count the occurrences of function symbols in the arguments of @b lit
+ * and return the depth of @b lit
+ */
+unsigned ClauseFeatures::addTerms(Literal* lit)
+{
+  CALL("ClauseFeatures::addTerms");
+
+  static Stack<pair<Term*,unsigned>> todo(8);
+  ASS(todo.isEmpty());
+
+  unsigned depth = 0;
+  todo.push(make_pair(lit, 0u));
+  while(todo.isNonEmpty()) {
+    Term* t = todo.top().first;
+    unsigned tdepth = todo.pop().second;
+    if(tdepth > depth) {
+      depth = tdepth;
+    }
+    for(TermList* arg = t->args(); !arg->isEmpty(); arg = arg->next()) {
+      if(arg->isTerm()) {
+        increment(FUNCTIONS + arg->term()->functor() % (COUNTERS - FUNCTIONS));
+        todo.push(make_pair(arg->term(), tdepth+1));
+      }
+    }
+  }
+  return depth;
+}
+
+void ClauseFeatures::increment(unsigned index)
+{
+  raise(index, counter(index) + 1);
+}
+
+/** Set the counter @b index to @b value if it is smaller */
+void ClauseFeatures::raise(unsigned index, unsigned value)
+{
+  if(value > MAX_COUNT) {
+    value = MAX_COUNT;
+  }
+  unsigned old = counter(index);
+  if(value > old) {
+    _words[index/8] += static_cast<uint64_t>(value - old) << (8*(index%8));
+  }
+}
+
+}
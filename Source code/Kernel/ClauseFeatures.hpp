@@ -0,0 +1,95 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ClauseFeatures.hpp
+ * Defines class ClauseFeatures.
+ */
+
+#ifndef __ClauseFeatures__
+#define __ClauseFeatures__
+
+#include <cstdint>
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+
+namespace Kernel {
+
+/**
+ * Feature vector of a clause, used to reject pairs of clauses that cannot
+ * be in the subsumption relation before their literals are matched.
+ *
+ * The features are byte counters saturating at 127: the number of literals,
+ * of positive and of negative literals, the maximal depth of a literal, the
+ * number of literals with each predicate symbol and polarity, and the number
+ * of occurrences of each function symbol. Symbols share counters by their
+ * number modulo the number of counters reserved for them.
+ *
+ * If a clause C subsumes a clause D, each counter of C is at most the
+ * corresponding counter of D, since subsumption maps the literals of C
+ * to distinct literals of D and instantiation never removes symbols or
+ * decreases depth. The counters are packed into 64-bit words and
+ * compared eight at a time.
+ */
+class ClauseFeatures
+{
+public:
+  CLASS_NAME(ClauseFeatures);
+  USE_ALLOCATOR(ClauseFeatures);
+
+  explicit ClauseFeatures(Clause* cl);
+
+  /**
+   * Return false if a clause with these features cannot subsume
+   * a clause with the features @b other
+   */
+  bool maySubsume(const ClauseFeatures& other) const
+  {
+    // for bytes a and b below 128, the top bit of the byte (b|128)-a is
+    // set iff a<=b, and the subtraction never borrows from the next byte
+    const uint64_t high = 0x8080808080808080ull;
+    for(unsigned i=0;i<WORDS;i++) {
+      if((((other._words[i] | high) - _words[i]) & high) != high) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Return the value of the counter @b index */
+  unsigned counter(unsigned index) const
+  { return (_words[index/8] >> (8*(index%8))) & 0xff; }
+
+  /** Number of counters */
+  static const unsigned COUNTERS = 32;
+
+private:
+  enum {
+    LENGTH = 0,
+    POSITIVE = 1,
+    NEGATIVE = 2,
+    DEPTH = 3,
+    PREDICATES = 4,
+    FUNCTIONS = 16
+  };
+  static const unsigned WORDS = COUNTERS/8;
+  static const unsigned MAX_COUNT = 127;
+
+  void increment(unsigned index);
+  void raise(unsigned index, unsigned value);
+  unsigned addTerms(Literal* lit);
+
+  uint64_t _words[WORDS];
+};
+
+}
+
+#endif // __ClauseFeatures__
@@ -426,6 +426,8 @@ enum class InferenceRule : unsigned char {
 
   /** inference coming from outside of Vampire */
   EXTERNAL,
+  /** lemma derived by another strategy of the same portfolio run */
+  IMPORTED_LEMMA,
 
   /* FMB flattening */
   FMB_FLATTENING,
@@ -20,6 +20,9 @@
 
 #include "Lib/Environment.hpp"
 #include "Lib/Comparison.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
+#include "Indexing/ResultSubstitution.hpp"
 
 #include "Shell/Options.hpp"
 #include <fstream>
@@ -681,6 +684,11 @@ Ordering::Result KBO::compare(TermList tl1, TermList tl2) const
   Term* t1=tl1.term();
   Term* t2=tl2.term();
 
+  Result res;
+  if(_compareCache && findCachedResult(t1, t2, res)) {
+    return res;
+  }
+
   ASS(_state);
   State* state=_state;
 #if VDEBUG
@@ -695,10 +703,138 @@ Ordering::Result KBO::compare(TermList tl1, TermList tl2) const
     state->traverse(tl1,1);
     state->traverse(tl2,-1);
   }
-  Result res=state->result(t1,t2);
+  res=state->result(t1,t2);
 #if VDEBUG
   _state=state;
 #endif
+  if(_compareCache) {
+    cacheResult(t1, t2, res);
+  }
+  return res;
+}
+
+/**
+ * Compares instances of the sides of an equation using the weights of the
+ * terms bound to the variables.
+ *
+ * The constructor computes the weight difference @b c of the non-variable
+ * symbols of the sides and the difference @b k_x of the number of occurrences
+ * of each variable x in them. The weight difference of the instances is then
+ * c + sum_x k_x*w(xσ), so only the bindings have to be traversed. If the
+ * difference is negative, the left instance is not greater. If it is positive
+ * and all k_x are non-negative, so that no variable occurs more often in the
+ * right instance, the left instance is greater. Only the remaining cases need
+ * a full comparison.
+ */
+class KBO::SideComparator
+: public Ordering::InstanceComparator
+{
+public:
+  CLASS_NAME(KBO::SideComparator);
+  USE_ALLOCATOR(KBO::SideComparator);
+
+  SideComparator(const KBO& kbo, TermList lhs, TermList rhs)
+  : _kbo(kbo), _weightDiff(0), _varCondition(true)
+  {
+    CALL("KBO::SideComparator::SideComparator");
+
+    DHMap<unsigned,int> coefs;
+    traverse(lhs, 1, coefs);
+    traverse(rhs, -1, coefs);
+
+    DHMap<unsigned,int>::Iterator it(coefs);
+    while(it.hasNext()) {
+      unsigned var;
+      int coef;
+      it.next(var, coef);
+      if(coef) {
+        _vars.push(make_pair(var, coef));
+        _varCondition &= coef > 0;
+      }
+    }
+  }
+
+  bool isGreater(TermList lhsS, TermList rhsS, Indexing::ResultSubstitution& subst) const override
+  {
+    CALL("KBO::SideComparator::isGreater");
+
+    int weightDiff = _weightDiff;
+    for(unsigned i=0;i<_vars.size();i++) {
+      weightDiff += _vars[i].second * _kbo.termWeight(subst.applyToBoundResult(TermList(_vars[i].first, false)));
+    }
+    if(weightDiff < 0) {
+      return false;
+    }
+    if(weightDiff > 0 && _varCondition) {
+      return true;
+    }
+    return _kbo.compare(lhsS, rhsS) == Ordering::GREATER;
+  }
+
+private:
+  void traverse(TermList tl, int coef, DHMap<unsigned,int>& coefs)
+  {
+    CALL("KBO::SideComparator::traverse");
+
+    static Stack<TermList> todo(8);
+    todo.push(tl);
+    while(todo.isNonEmpty()) {
+      TermList t = todo.pop();
+      if(t.isVar()) {
+        int* varCoef;
+        coefs.getValuePtr(t.var(), varCoef, 0);
+        *varCoef += coef;
+        continue;
+      }
+      _weightDiff += _kbo.symbolWeight(t.term()) * coef;
+      for(TermList* arg = t.term()->args(); !arg->isEmpty(); arg = arg->next()) {
+        todo.push(*arg);
+      }
+    }
+  }
+
+  const KBO& _kbo;
+  /** weight difference of the non-variable symbols */
+  int _weightDiff;
+  /** variables with their non-zero occurrence differences */
+  Stack<pair<unsigned,int>> _vars;
+  /** true if all occurrence differences are non-negative */
+  bool _varCondition;
+};
+
+Ordering::InstanceComparator* KBO::createInstanceComparator(TermList lhs, TermList rhs) const
+{
+  CALL("KBO::createInstanceComparator");
+
+  if(lhs.isVar()) {
+    return 0;
+  }
+  return new SideComparator(*this, lhs, rhs);
+}
+
+/** Return the weight of @b t, the sum of the weights of its symbols and variables */
+int KBO::termWeight(TermList t) const
+{
+  CALL("KBO::termWeight");
+
+  if(t.isVar()) {
+    return _funcWeights._specialWeights._variableWeight;
+  }
+  int res = 0;
+  static Stack<Term*> todo(8);
+  todo.push(t.term());
+  while(todo.isNonEmpty()) {
+    Term* s = todo.pop();
+    res += symbolWeight(s);
+    for(TermList* arg = s->args(); !arg->isEmpty(); arg = arg->next()) {
+      if(arg->isVar()) {
+        res += _funcWeights._specialWeights._variableWeight;
+      }
+      else {
+        todo.push(arg->term());
+      }
+    }
+  }
   return res;
 }
 
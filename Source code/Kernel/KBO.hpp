@@ -157,14 +157,17 @@ public:
 
   using PrecedenceOrdering::compare;
   Result compare(TermList tl1, TermList tl2) const override;
+  InstanceComparator* createInstanceComparator(TermList lhs, TermList rhs) const override;
 protected:
   Result comparePredicates(Literal* l1, Literal* l2) const override;
 
 
   class State;
+  class SideComparator;
 
   // int functionSymbolWeight(unsigned fun) const;
   int symbolWeight(Term* t) const;
+  int termWeight(TermList t) const;
 
 private:
 
@@ -75,7 +75,16 @@ Ordering::Result LPO::compare(TermList tl1, TermList tl2) const
     return tl2.containsSubterm(tl1) ? LESS : INCOMPARABLE;
   }
   ASS(tl1.isTerm());
-  return clpo(tl1.term(), tl2);
+  if(!_compareCache || tl2.isVar()) {
+    return clpo(tl1.term(), tl2);
+  }
+
+  Result res;
+  if(!findCachedResult(tl1.term(), tl2.term(), res)) {
+    res = clpo(tl1.term(), tl2);
+    cacheResult(tl1.term(), tl2.term(), res);
+  }
+  return res;
 }
 
 Ordering::Result LPO::clpo(Term* t1, TermList tl2) const
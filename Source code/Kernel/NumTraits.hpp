@@ -118,7 +118,7 @@ struct NumTraits;
     }                                                                                                         \
 
 #define IMPL_NUM_TRAITS__SPECIAL_CONSTANT(name, value, isName)                                                \
-    constexpr static ConstantType name ## C = ConstantType(value);                                            \
+    static const ConstantType name ## C;                                                                      \
     static Term* name ## T() {  /* TODO refactor to const& Term */                                            \
       static Term* trm = theory->representConstant(name ## C);                                                \
       return trm;                                                                                             \
@@ -183,8 +183,8 @@ struct NumTraits;
   };                                                                                                          \
 
 #define __INSTANTIATE_NUM_TRAITS(CamelCase)                                                                   \
-  constexpr CamelCase ## ConstantType NumTraits<CamelCase ## ConstantType>::oneC;                             \
-  constexpr CamelCase ## ConstantType NumTraits<CamelCase ## ConstantType>::zeroC;                            \
+  const CamelCase ## ConstantType NumTraits<CamelCase ## ConstantType>::oneC = CamelCase ## ConstantType(1);   \
+  const CamelCase ## ConstantType NumTraits<CamelCase ## ConstantType>::zeroC = CamelCase ## ConstantType(0);  \
 
 #define __INSTANTIATE_NUM_TRAITS_ALL                                                                          \
   __INSTANTIATE_NUM_TRAITS(Rational)                                                                          \
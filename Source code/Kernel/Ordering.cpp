@@ -18,6 +18,7 @@
 
 #include "Indexing/TermSharing.hpp"
 
+#include "Lib/Cache.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Exception.hpp"
 #include "Lib/List.hpp"
@@ -29,6 +30,7 @@
 
 #include "Shell/Options.hpp"
 #include "Shell/Property.hpp"
+#include "Shell/Statistics.hpp"
 
 #include "LPO.hpp"
 #include "KBO.hpp"
@@ -50,7 +52,25 @@ using namespace Kernel;
 
 OrderingSP Ordering::s_globalOrdering;
 
+/**
+ * Cache of the results of comparing shared terms, keyed by the pair of
+ * their ids
+ */
+class Ordering::CompareCache
+: public Cache<unsigned long long, Ordering::Result, Hash>
+{
+public:
+  CLASS_NAME(Ordering::CompareCache);
+  USE_ALLOCATOR(Ordering::CompareCache);
+
+  explicit CompareCache(size_t maxSize) : Cache(maxSize) {}
+
+  static unsigned long long key(Term* t1, Term* t2)
+  { return (static_cast<unsigned long long>(t1->getId()) << 32) | t2->getId(); }
+};
+
 Ordering::Ordering()
+: _compareCache(0)
 {
   CALL("Ordering::Ordering");
 
@@ -63,6 +83,74 @@ Ordering::~Ordering()
   CALL("Ordering::~Ordering");
 
   destroyEqualityComparator();
+  if(_compareCache) {
+    delete _compareCache;
+  }
+}
+
+/**
+ * Let compare() remember the results of comparing shared terms in a cache
+ * of at most @b maxEntries entries (rounded down to a power of two)
+ */
+void Ordering::enableCompareCache(size_t maxEntries)
+{
+  CALL("Ordering::enableCompareCache");
+  ASS(!_compareCache);
+  ASS_G(maxEntries, 0);
+
+  size_t size = 1;
+  while(size*2 <= maxEntries) {
+    size *= 2;
+  }
+  _compareCache = new CompareCache(size);
+}
+
+/**
+ * If the result of comparing terms @b t1 and @b t2 is cached, assign it
+ * to @b res and return true
+ *
+ * Must only be called when the cache is enabled.
+ */
+bool Ordering::findCachedResult(Term* t1, Term* t2, Result& res) const
+{
+  CALL("Ordering::findCachedResult");
+  ASS(_compareCache);
+
+  if(!t1->shared() || !t2->shared() || t1->isSort() || t2->isSort()) {
+    return false;
+  }
+  if(_compareCache->find(CompareCache::key(t1, t2), res)) {
+    env.statistics->orderingCacheHits++;
+    return true;
+  }
+  env.statistics->orderingCacheMisses++;
+  return false;
+}
+
+/**
+ * Store @b res as the result of comparing terms @b t1 and @b t2
+ *
+ * Must only be called when the cache is enabled.
+ */
+void Ordering::cacheResult(Term* t1, Term* t2, Result res) const
+{
+  CALL("Ordering::cacheResult");
+  ASS(_compareCache);
+
+  if(!t1->shared() || !t2->shared() || t1->isSort() || t2->isSort()) {
+    return;
+  }
+  _compareCache->insert(CompareCache::key(t1, t2), res);
+}
+
+/**
+ * Return an object deciding whether instances of @b lhs are greater than
+ * the corresponding instances of @b rhs faster than compare() does, or 0 if
+ * the ordering provides no such object. The caller takes over the object.
+ */
+Ordering::InstanceComparator* Ordering::createInstanceComparator(TermList lhs, TermList rhs) const
+{
+  return 0;
 }
 
 
@@ -146,6 +234,9 @@ Ordering* Ordering::create(Problem& prb, const Options& opt)
   default:
     ASSERTION_VIOLATION;
   }
+  if (opt.orderingCache()) {
+    out->enableCompareCache(opt.orderingCache());
+  }
   //TODO currently do not show SKIKBO
   if (opt.showSimplOrdering()) {
     env.beginOutput();
@@ -66,6 +66,28 @@ public:
    * @b t1 and @b t2 */
   virtual Result compare(TermList t1,TermList t2) const = 0;
 
+  /**
+   * Decides whether instances of one side of an equation are greater than
+   * the corresponding instances of the other side
+   * (see createInstanceComparator())
+   */
+  class InstanceComparator
+  {
+  public:
+    CLASS_NAME(Ordering::InstanceComparator);
+    USE_ALLOCATOR(Ordering::InstanceComparator);
+
+    virtual ~InstanceComparator() {}
+    /**
+     * Return true if @b lhsS is greater than @b rhsS, where @b lhsS and @b rhsS
+     * are the sides the comparator was created for after applying @b subst
+     * to them as bound result terms
+     */
+    virtual bool isGreater(TermList lhsS, TermList rhsS, Indexing::ResultSubstitution& subst) const = 0;
+  };
+
+  virtual InstanceComparator* createInstanceComparator(TermList lhs, TermList rhs) const;
+
   virtual void show(ostream& out) const = 0;
 
   static bool isGorGEorE(Result r) { return (r == GREATER || r == GREATER_EQ || r == EQUAL); }
@@ -105,10 +127,19 @@ public:
   static Ordering* tryGetGlobalOrdering();
 
   Result getEqualityArgumentOrder(Literal* eq) const;
+
+  void enableCompareCache(size_t maxEntries);
 protected:
 
   Result compareEqualities(Literal* eq1, Literal* eq2) const;
 
+  bool findCachedResult(Term* t1, Term* t2, Result& res) const;
+  void cacheResult(Term* t1, Term* t2, Result res) const;
+
+  class CompareCache;
+  /** Results of comparisons of shared terms, or 0 if they are not cached */
+  CompareCache* _compareCache;
+
 private:
 
   enum ArgumentOrderVals {
@@ -17,8 +17,10 @@
 #include "Debug/Assertion.hpp"
 #include "Debug/Tracer.hpp"
 
+#include "Lib/BitUtils.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
+#include "Lib/Stack.hpp"
 
 #include "Shell/Skolem.hpp"
 
@@ -29,7 +31,6 @@
 #include "Kernel/NumTraits.hpp"
 
 #include "Theory.hpp"
-#define USES_2_COMPLEMENT (~0 == -1)
 
 namespace Kernel
 {
@@ -40,13 +41,236 @@ using namespace Lib;
 // IntegerConstantType
 //
 
+/*
+ * Magnitudes of big values are stacks of limbs in base 2^32 with the least
+ * significant limb first and no leading zero limbs. The value zero is the
+ * empty stack.
+ */
+typedef Stack<unsigned> Limbs;
+
+static void trimMagnitude(Limbs& a)
+{
+  while (a.isNonEmpty() && a.top() == 0) {
+    a.pop();
+  }
+}
+
+static int compareMagnitudes(const Limbs& a, const Limbs& b)
+{
+  if (a.size() != b.size()) {
+    return a.size() < b.size() ? -1 : 1;
+  }
+  for (unsigned i = a.size(); i-- > 0; ) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+static void addMagnitudes(const Limbs& a, const Limbs& b, Limbs& res)
+{
+  res.reset();
+  unsigned long long carry = 0;
+  for (unsigned i = 0; i < a.size() || i < b.size(); i++) {
+    unsigned long long sum = carry;
+    if (i < a.size()) { sum += a[i]; }
+    if (i < b.size()) { sum += b[i]; }
+    res.push(static_cast<unsigned>(sum));
+    carry = sum >> 32;
+  }
+  if (carry) {
+    res.push(static_cast<unsigned>(carry));
+  }
+}
+
+/** res = a - b, where a >= b */
+static void subtractMagnitudes(const Limbs& a, const Limbs& b, Limbs& res)
+{
+  ASS_GE(compareMagnitudes(a, b), 0);
+
+  res.reset();
+  long long borrow = 0;
+  for (unsigned i = 0; i < a.size(); i++) {
+    long long diff = static_cast<long long>(a[i]) - borrow - (i < b.size() ? b[i] : 0);
+    borrow = diff < 0;
+    res.push(static_cast<unsigned>(diff + (borrow << 32)));
+  }
+  ASS_EQ(borrow, 0);
+  trimMagnitude(res);
+}
+
+static void multiplyMagnitudes(const Limbs& a, const Limbs& b, Limbs& res)
+{
+  res.reset();
+  if (a.isEmpty() || b.isEmpty()) {
+    return;
+  }
+  for (unsigned i = 0; i < a.size() + b.size(); i++) {
+    res.push(0);
+  }
+  for (unsigned i = 0; i < a.size(); i++) {
+    unsigned long long carry = 0;
+    for (unsigned j = 0; j < b.size(); j++) {
+      unsigned long long cur = static_cast<unsigned long long>(a[i]) * b[j] + res[i+j] + carry;
+      res[i+j] = static_cast<unsigned>(cur);
+      carry = cur >> 32;
+    }
+    res[i+b.size()] = static_cast<unsigned>(carry);
+  }
+  trimMagnitude(res);
+}
+
+/** Divide @b a by the non-zero @b d in place and return the remainder */
+static unsigned divideMagnitudeBySmall(Limbs& a, unsigned d)
+{
+  ASS_NEQ(d, 0);
+
+  unsigned long long rem = 0;
+  for (unsigned i = a.size(); i-- > 0; ) {
+    unsigned long long cur = (rem << 32) | a[i];
+    a[i] = static_cast<unsigned>(cur / d);
+    rem = cur % d;
+  }
+  trimMagnitude(a);
+  return static_cast<unsigned>(rem);
+}
+
+/** a = a*m + c */
+static void multiplyAddSmall(Limbs& a, unsigned m, unsigned c)
+{
+  unsigned long long carry = c;
+  for (unsigned i = 0; i < a.size(); i++) {
+    unsigned long long cur = static_cast<unsigned long long>(a[i]) * m + carry;
+    a[i] = static_cast<unsigned>(cur);
+    carry = cur >> 32;
+  }
+  if (carry) {
+    a.push(static_cast<unsigned>(carry));
+  }
+}
+
+/**
+ * Long division of magnitudes, @b b being non-zero
+ *
+ * Big values only arise after an overflow, so a bit by bit division is
+ * good enough for divisors of more than one limb.
+ */
+static void divideMagnitudes(const Limbs& a, const Limbs& b, Limbs& quot, Limbs& rem)
+{
+  ASS(b.isNonEmpty());
+
+  if (b.size() == 1) {
+    quot = a;
+    unsigned r = divideMagnitudeBySmall(quot, b[0]);
+    rem.reset();
+    if (r) {
+      rem.push(r);
+    }
+    return;
+  }
+
+  quot.reset();
+  for (unsigned i = 0; i < a.size(); i++) {
+    quot.push(0);
+  }
+  rem.reset();
+  Limbs aux;
+  for (unsigned i = a.size()*32; i-- > 0; ) {
+    // rem = 2*rem + the i-th bit of a
+    multiplyAddSmall(rem, 2, (a[i/32] >> (i%32)) & 1);
+    trimMagnitude(rem);
+    if (compareMagnitudes(rem, b) >= 0) {
+      subtractMagnitudes(rem, b, aux);
+      swap(rem, aux);
+      quot[i/32] |= 1u << (i%32);
+    }
+  }
+  trimMagnitude(quot);
+}
+
+void IntegerConstantType::toSignMagnitude(bool& negative, Limbs& mag) const
+{
+  if (_big) {
+    negative = _val < 0;
+    mag = *_big;
+    return;
+  }
+  negative = _val < 0;
+  mag.reset();
+  if (_val) {
+    mag.push(Int::safeAbs(_val));
+  }
+}
+
+/** Create the value of the given sign and magnitude, @b mag is consumed */
+IntegerConstantType IntegerConstantType::fromSignMagnitude(bool negative, Limbs& mag)
+{
+  trimMagnitude(mag);
+  if (mag.isEmpty()) {
+    return IntegerConstantType(0);
+  }
+  if (mag.size() == 1) {
+    unsigned m = mag[0];
+    if (m <= static_cast<unsigned>(numeric_limits<InnerType>::max())) {
+      InnerType v = static_cast<InnerType>(m);
+      return IntegerConstantType(negative ? -v : v);
+    }
+    if (negative && m == Int::safeAbs(numeric_limits<InnerType>::min())) {
+      return IntegerConstantType(numeric_limits<InnerType>::min());
+    }
+  }
+  IntegerConstantType res(negative ? -1 : 1);
+  res._big = new Limbs(std::move(mag));
+  return res;
+}
+
+IntegerConstantType& IntegerConstantType::operator=(const IntegerConstantType& o)
+{
+  if (this != &o) {
+    Limbs* big = o._big ? new Limbs(*o._big) : 0;
+    if (_big) {
+      delete _big;
+    }
+    _val = o._val;
+    _big = big;
+  }
+  return *this;
+}
+
+IntegerConstantType& IntegerConstantType::operator=(IntegerConstantType&& o)
+{
+  swap(_val, o._val);
+  swap(_big, o._big);
+  return *this;
+}
+
 IntegerConstantType::IntegerConstantType(const vstring& str)
+: _val(0), _big(0)
 {
   CALL("IntegerConstantType::IntegerConstantType(vstring)");
 
-  if (!Int::stringToInt(str, _val)) {
+  if (Int::stringToInt(str, _val)) {
+    return;
+  }
+
+  size_t i = 0;
+  bool negative = false;
+  if (i < str.size() && (str[i] == '-' || str[i] == '+')) {
+    negative = str[i] == '-';
+    i++;
+  }
+  if (i == str.size()) {
     throw MachineArithmeticException();
   }
+  Limbs mag;
+  for (; i < str.size(); i++) {
+    if (str[i] < '0' || str[i] > '9') {
+      throw MachineArithmeticException();
+    }
+    multiplyAddSmall(mag, 10, str[i] - '0');
+  }
+  *this = fromSignMagnitude(negative, mag);
 }
 
 IntegerConstantType IntegerConstantType::operator+(const IntegerConstantType& num) const
@@ -54,10 +278,24 @@ IntegerConstantType IntegerConstantType::operator+(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator+");
 
   InnerType res;
-  if (!Int::safePlus(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safePlus(_val, num._val, res)) {
+    return IntegerConstantType(res);
+  }
+
+  bool neg1, neg2;
+  Limbs mag1, mag2, mag;
+  toSignMagnitude(neg1, mag1);
+  num.toSignMagnitude(neg2, mag2);
+  if (neg1 == neg2) {
+    addMagnitudes(mag1, mag2, mag);
+    return fromSignMagnitude(neg1, mag);
+  }
+  if (compareMagnitudes(mag1, mag2) >= 0) {
+    subtractMagnitudes(mag1, mag2, mag);
+    return fromSignMagnitude(neg1, mag);
   }
-  return IntegerConstantType(res);
+  subtractMagnitudes(mag2, mag1, mag);
+  return fromSignMagnitude(neg2, mag);
 }
 
 IntegerConstantType IntegerConstantType::operator-(const IntegerConstantType& num) const
@@ -65,10 +303,10 @@ IntegerConstantType IntegerConstantType::operator-(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator-/1");
 
   InnerType res;
-  if (!Int::safeMinus(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safeMinus(_val, num._val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+  return (*this) + (-num);
 }
 
 IntegerConstantType IntegerConstantType::operator-() const
@@ -76,10 +314,14 @@ IntegerConstantType IntegerConstantType::operator-() const
   CALL("IntegerConstantType::operator-/0");
 
   InnerType res;
-  if (!Int::safeUnaryMinus(_val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && Int::safeUnaryMinus(_val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+
+  bool neg;
+  Limbs mag;
+  toSignMagnitude(neg, mag);
+  return fromSignMagnitude(!neg, mag);
 }
 
 IntegerConstantType IntegerConstantType::operator*(const IntegerConstantType& num) const
@@ -87,41 +329,87 @@ IntegerConstantType IntegerConstantType::operator*(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator*");
 
   InnerType res;
-  if (!Int::safeMultiply(_val, num._val, res)) {
-    throw MachineArithmeticException();
+  if (!_big && !num._big && Int::safeMultiply(_val, num._val, res)) {
+    return IntegerConstantType(res);
   }
-  return IntegerConstantType(res);
+
+  bool neg1, neg2;
+  Limbs mag1, mag2, mag;
+  toSignMagnitude(neg1, mag1);
+  num.toSignMagnitude(neg2, mag2);
+  multiplyMagnitudes(mag1, mag2, mag);
+  return fromSignMagnitude(neg1 != neg2, mag);
 }
 
-inline typename IntegerConstantType::InnerType divideOrThrow(typename IntegerConstantType::InnerType lhs, typename IntegerConstantType::InnerType rhs) {
-    typename IntegerConstantType::InnerType out;
-    if (!Int::safeDivide(lhs,rhs, out))
-      throw MachineArithmeticException();
-    return out;
+/**
+ * Division rounding towards zero, as done by C++ for InnerType
+ * (the remainder has the sign of @b n1). @b n2 must not be zero.
+ */
+void IntegerConstantType::divideT(const IntegerConstantType& n1, const IntegerConstantType& n2,
+                                  IntegerConstantType& quotient, IntegerConstantType& remainder)
+{
+  CALL("IntegerConstantType::divideT");
+  ASS(!n2.isZero());
+
+  if (!n1._big && !n2._big && 
+      !(n1._val == numeric_limits<InnerType>::min() && n2._val == -1)) {
+    quotient = IntegerConstantType(n1._val / n2._val);
+    remainder = IntegerConstantType(n1._val % n2._val);
+    return;
+  }
+
+  bool neg1, neg2;
+  Limbs mag1, mag2, quot, rem;
+  n1.toSignMagnitude(neg1, mag1);
+  n2.toSignMagnitude(neg2, mag2);
+  divideMagnitudes(mag1, mag2, quot, rem);
+  quotient = fromSignMagnitude(neg1 != neg2, quot);
+  remainder = fromSignMagnitude(neg1, rem);
 }
 
-int IntegerConstantType::intDivide(const IntegerConstantType& num) const 
+IntegerConstantType IntegerConstantType::intDivide(const IntegerConstantType& num) const 
 {
-    CALL("IntegerConstantType::intDivide");
-    ASS_REP(num.divides(*this),  num.toString() + " does not divide " + this->toString() );
-    return divideOrThrow(_val, num._val);
+  CALL("IntegerConstantType::intDivide");
+  ASS_REP(num.divides(*this),  num.toString() + " does not divide " + this->toString() );
+
+  IntegerConstantType quot, rem;
+  divideT(*this, num, quot, rem);
+  return quot;
+}
+
+float IntegerConstantType::realDivide(const IntegerConstantType& num) const
+{
+  if(num.isZero()) throw DivByZeroException();
+  if (!_big && !num._big) {
+    return ((float)_val)/num._val;
+  }
+  return toDouble()/num.toDouble();
+}
+
+double IntegerConstantType::toDouble() const
+{
+  if (!_big) {
+    return _val;
+  }
+  double res = 0;
+  for (unsigned i = _big->size(); i-- > 0; ) {
+    res = res * 4294967296.0 + (*_big)[i];
+  }
+  return _val < 0 ? -res : res;
 }
 
 IntegerConstantType IntegerConstantType::remainderE(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::remainderE");
 
-  if (num._val == 0) {
+  if (num.isZero()) {
     throw MachineArithmeticException();
   }
 
-  if (this->_val == numeric_limits<IntegerConstantType::InnerType>::min() && num._val == -1) {
-    return 0;
-  }
-
-  auto mod = IntegerConstantType(this->_val % num._val);
-  if (mod < 0) {
-    if (num._val >= 0) {
+  IntegerConstantType quot, mod;
+  divideT(*this, num, quot, mod);
+  if (mod.isNegative()) {
+    if (!num.isNegative()) {
       mod = mod + num;
     } else {
       mod = mod - num;
@@ -145,9 +433,7 @@ RealConstantType RealConstantType::abs() const
 
 IntegerConstantType IntegerConstantType::abs() const
 {
-  if (toInner() == std::numeric_limits<InnerType>::min() && USES_2_COMPLEMENT)
-    throw new MachineArithmeticException();
-  return IntegerConstantType(::std::abs(toInner()));
+  return isNegative() ? -(*this) : *this;
 }
 
 /**
@@ -158,65 +444,62 @@ IntegerConstantType IntegerConstantType::quotientE(const IntegerConstantType& nu
 { 
   CALL("IntegerConstantType::quotientE");
 
-  if (num._val == 0) {
+  if (num.isZero()) {
     throw DivByZeroException();
   }
 
-  if (this->_val == numeric_limits<IntegerConstantType::InnerType>::min() && num._val == -1) {
-    throw MachineArithmeticException();
-  }
-
-  // as in remainderE
-  auto mod = IntegerConstantType(this->_val % num._val);
-
-  // return (*this - this->remainderE(num)).intDivide(num); // the clean definition; but we don't want to subtract for small *this
-
-  if (mod < 0) {
-    // as in remainderE -- effectively adjust for the computation of the positive mod
-    if (num._val >= 0) {
-      return (*this - mod).intDivide(num)-1;
+  // as in remainderE -- adjust the truncated quotient for a negative remainder
+  IntegerConstantType quot, mod;
+  divideT(*this, num, quot, mod);
+  if (mod.isNegative()) {
+    if (!num.isNegative()) {
+      return quot - 1;
     } else {
-      return (*this - mod).intDivide(num)+1;
-    }
-  } else {
-    if (*this < 0) { // we don't want to subtract a positive mod, counterbalance with num, adjusting with +/-1
-      if (num._val >= 0) {
-        return (*this + num - mod).intDivide(num)-1;
-      } else {
-        return (*this - num - mod).intDivide(num)+1;
-      }
-    } else {
-      return (*this - mod).intDivide(num);
+      return quot + 1;
     }
   }
+  return quot;
 }
 
 IntegerConstantType IntegerConstantType::quotientF(const IntegerConstantType& num) const
 { 
-  if(num.divides(*this)){
-    return IntegerConstantType(intDivide(num));
+  if (num.isZero()) {
+    throw DivByZeroException();
+  }
+
+  IntegerConstantType quot, rem;
+  divideT(*this, num, quot, rem);
+  if (!rem.isZero() && rem.isNegative() != num.isNegative()) {
+    return quot - 1;
   }
-  return IntegerConstantType(::floor(realDivide(num)));
+  return quot;
 }
 
 IntegerConstantType IntegerConstantType::quotientT(const IntegerConstantType& num) const
 { 
-  if(num.divides(*this)){
-    return IntegerConstantType(intDivide(num));
+  if (num.isZero()) {
+    throw DivByZeroException();
   }
-  return IntegerConstantType(::trunc(realDivide(num)));
+
+  IntegerConstantType quot, rem;
+  divideT(*this, num, quot, rem);
+  return quot;
 }
 
 bool IntegerConstantType::divides(const IntegerConstantType& num) const 
 {
   CALL("IntegerConstantType:divides");
-  if (_val == 0) { return false; }
-  if (num._val == _val) { return true; }
-  if (num._val == numeric_limits<decltype(num._val)>::min() && _val == -1) {
-    return true;
-  } else {
-    return ( num._val % _val == 0);
+  if (isZero()) { return false; }
+  if (!_big && !num._big) {
+    if (num._val == _val) { return true; }
+    if (num._val == numeric_limits<InnerType>::min() && _val == -1) {
+      return true;
+    }
+    return num._val % _val == 0;
   }
+  IntegerConstantType quot, rem;
+  divideT(num, *this, quot, rem);
+  return rem.isZero();
 }
 
 //TODO remove this operator. We already have 3 other ways of computing the remainder, required by the semantics of TPTP and SMTCOMP.
@@ -225,24 +508,42 @@ IntegerConstantType IntegerConstantType::operator%(const IntegerConstantType& nu
   CALL("IntegerConstantType::operator%");
 
   //TODO: check if modulo corresponds to the TPTP semantic
-  if (num._val==0) {
+  if (num.isZero()) {
     throw DivByZeroException();
   }
-  return IntegerConstantType(_val%num._val);
+  IntegerConstantType quot, rem;
+  divideT(*this, num, quot, rem);
+  return rem;
 }
 
 bool IntegerConstantType::operator==(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::operator==");
 
-  return _val==num._val;
+  if (!_big || !num._big) {
+    // the representation is unique, a big value is never equal to a small one
+    return _val==num._val && !_big && !num._big;
+  }
+  return _val==num._val && compareMagnitudes(*_big, *num._big) == 0;
 }
 
 bool IntegerConstantType::operator>(const IntegerConstantType& num) const
 {
   CALL("IntegerConstantType::operator>");
 
-  return _val>num._val;
+  if (!_big && !num._big) {
+    return _val>num._val;
+  }
+  if (isNegative() != num.isNegative()) {
+    return num.isNegative();
+  }
+  // the same sign, the value with a bigger magnitude is further from zero
+  bool neg;
+  Limbs mag1, mag2;
+  toSignMagnitude(neg, mag1);
+  num.toSignMagnitude(neg, mag2);
+  int cmp = compareMagnitudes(mag1, mag2);
+  return neg ? cmp < 0 : cmp > 0;
 }
 
 IntegerConstantType IntegerConstantType::floor(IntegerConstantType x)
@@ -260,9 +561,9 @@ IntegerConstantType IntegerConstantType::floor(RationalConstantType rat)
   /* there is a non-zero remainder for num / den */
   ASS_G(den, 0);
   if (num >= IntegerConstantType(0)) {
-    return IntegerConstantType(num.toInner() /den.toInner());
+    return num.quotientT(den);
   } else  {
-    return IntegerConstantType(num.toInner() / den.toInner() - 1);
+    return num.quotientT(den) - 1;
   }
 }
 
@@ -285,49 +586,77 @@ IntegerConstantType IntegerConstantType::ceiling(RationalConstantType rat)
   /* there is a remainder for num / den */
   ASS_G(den, 0);
   if (num >= IntegerConstantType(0)) {
-    return IntegerConstantType(num.toInner() /den.toInner() + 1);
+    return num.quotientT(den) + 1;
   } else  {
-    return IntegerConstantType(num.toInner() / den.toInner());
+    return num.quotientT(den);
   }
 }
 
-Comparison IntegerConstantType::comparePrecedence(IntegerConstantType n1, IntegerConstantType n2)
+IntegerConstantType IntegerConstantType::gcd(const IntegerConstantType& n1, const IntegerConstantType& n2)
 {
-  CALL("IntegerConstantType::comparePrecedence");
-  try {
-    if (n1 == numeric_limits<InnerType>::min()) {
-      if (n2 == numeric_limits<InnerType>::min()) {
-        return EQUAL;
-      } else {
-        return GREATER;
-      }
-    } else {
-      if (n2 == numeric_limits<InnerType>::min()) {
-        return LESS;
-      } else {
-        InnerType an1 = n1.abs().toInner();
-        InnerType an2 = n2.abs().toInner();
+  CALL("IntegerConstantType::gcd");
 
-        ASS_GE(an1,0);
-        ASS_GE(an2,0);
+  if (!n1._big && !n2._big) {
+    Limbs mag;
+    mag.push(Int::gcd(n1._val, n2._val));
+    return fromSignMagnitude(false, mag);
+  }
 
-        return an1 < an2 ? LESS : (an1 == an2 ? // compare the signed ones, making negative greater than positive
-            static_cast<Comparison>(-Int::compare(n1.toInner(), n2.toInner()))
-                              : GREATER);
-      }
-    }
+  IntegerConstantType a = n1.abs();
+  IntegerConstantType b = n2.abs();
+  while (!b.isZero()) {
+    IntegerConstantType quot, rem;
+    divideT(a, b, quot, rem);
+    a = std::move(b);
+    b = std::move(rem);
   }
-  catch(ArithmeticException&) {
-    ASSERTION_VIOLATION;
-    throw;
+  return a;
+}
+
+unsigned IntegerConstantType::log2Abs() const
+{
+  if (!_big) {
+    return BitUtils::log2(Int::safeAbs(_val));
   }
+  return 32*(_big->size()-1) + BitUtils::log2(_big->top());
+}
+
+Comparison IntegerConstantType::comparePrecedence(IntegerConstantType n1, IntegerConstantType n2)
+{
+  CALL("IntegerConstantType::comparePrecedence");
+
+  IntegerConstantType an1 = n1.abs();
+  IntegerConstantType an2 = n2.abs();
+
+  ASS_GE(an1,0);
+  ASS_GE(an2,0);
+
+  return an1 < an2 ? LESS : (an1 == an2 ? // compare the signed ones, making negative greater than positive
+      (n1 < n2 ? GREATER : (n1 == n2 ? EQUAL : LESS))
+                        : GREATER);
 }
 
 vstring IntegerConstantType::toString() const
 {
   CALL("IntegerConstantType::toString");
 
-  return Int::toString(_val);
+  if (!_big) {
+    return Int::toString(_val);
+  }
+
+  // print in chunks of nine decimal digits, the least significant first
+  Limbs mag(*_big);
+  Stack<unsigned> chunks;
+  while (mag.isNonEmpty()) {
+    chunks.push(divideMagnitudeBySmall(mag, 1000000000));
+  }
+  vstring res = _val < 0 ? "-" : "";
+  res += Int::toString(chunks.pop());
+  while (chunks.isNonEmpty()) {
+    vstring chunk = Int::toString(chunks.pop());
+    res += vstring(9-chunk.size(), '0') + chunk;
+  }
+  return res;
 }
 
 ///////////////////////
@@ -357,7 +686,7 @@ void RationalConstantType::init(InnerType num, InnerType den)
   cannonize();
 
   // Dividing by zero is bad!
-  if(_den.toInner()==0) throw DivByZeroException();
+  if(_den.isZero()) throw DivByZeroException();
 }
 
 RationalConstantType RationalConstantType::operator+(const RationalConstantType& o) const
@@ -418,11 +747,15 @@ bool RationalConstantType::operator==(const RationalConstantType& o) const
 bool RationalConstantType::operator>(const RationalConstantType& o) const
 {
   CALL("IntegerConstantType::operator>");
-  /* prevents overflows */
-  auto toLong = [](IntegerConstantType t)  -> long int
-  { return  t.toInner(); };
 
-  return toLong(_num)*toLong(o._den)>(toLong(o._num)*toLong(_den));
+  if (_num.fitsInner() && _den.fitsInner() && o._num.fitsInner() && o._den.fitsInner()) {
+    /* prevents overflows */
+    auto toLong = [](const IntegerConstantType& t)  -> long long int
+    { return  t.toInner(); };
+
+    return toLong(_num)*toLong(o._den)>(toLong(o._num)*toLong(_den));
+  }
+  return _num*o._den > o._num*_den;
 }
 
 
@@ -445,17 +778,7 @@ void RationalConstantType::cannonize()
 {
   CALL("RationalConstantType::cannonize");
 
-  unsigned gcd = Int::gcd(_num.toInner(), _den.toInner());
-  if (gcd == (unsigned)(-(long long)(numeric_limits<int>::min()))) { // we are talking about 2147483648, but I can't take minus of it's int representation!
-    ASS_EQ(_num, numeric_limits<int>::min());
-    ASS_EQ(_den, numeric_limits<int>::min());
-    _num = 1;
-    _den = 1;
-    return;
-  }
-
-  // now it's safe to treat this unsigned as signed
-  ASS_LE(gcd,(unsigned)numeric_limits<signed>::max());
+  IntegerConstantType gcd = IntegerConstantType::gcd(_num, _den);
   if (gcd!=1) {
     _num = _num.intDivide(gcd);
     _den = _den.intDivide(gcd);
@@ -599,39 +922,35 @@ RealConstantType::RealConstantType(const vstring& number)
     return;
   }
 
-  double numDbl;
-  if (!Int::stringToDouble(number, numDbl)) {
+  // with an exponent, e.g. 1.5E-3, the value is the mantissa times a power of ten
+  size_t ePos = number.find_first_of("eE");
+  int exponent;
+  if (ePos==vstring::npos || !parseDouble(number.substr(0, ePos), value) ||
+      !Int::stringToInt(number.substr(ePos+1), exponent)) {
     throw MachineArithmeticException();
   }
-  InnerType denominator = 1;
-  while(::floor(numDbl)!=numDbl) {
-    denominator = denominator*10;
-    numDbl *= 10;
-  }
-
-  if (numDbl > numeric_limits<InnerType::InnerType>::max() ||
-      numDbl < numeric_limits<InnerType::InnerType>::min()) {
-    //the numerator part of double doesn't fit inside the inner integer type
+  // the digits of the power are kept in memory, so refuse absurd exponents
+  unsigned absExponent = exponent<0 ? -(unsigned)exponent : exponent;
+  if (absExponent>10000) {
     throw MachineArithmeticException();
   }
-
-  InnerType::InnerType numerator = static_cast<InnerType::InnerType>(numDbl);
-  // the test below should now never trigger (thanks to the one above), but we include it to preserve the original semantics
-  if (numerator!=numDbl) {
-    //the numerator part of double doesn't fit inside the inner integer type
-    throw MachineArithmeticException();
+  InnerType power(vstring("1")+vstring(absExponent, '0'));
+  if (exponent>=0) {
+    init(value.numerator()*power, value.denominator());
+  }
+  else {
+    init(value.numerator(), value.denominator()*power);
   }
-  init(numerator, denominator);
 }
 
 vstring RealConstantType::toNiceString() const
 {
   CALL("RealConstantType::toNiceString");
 
-  if (denominator().toInner()==1) {
+  if (denominator()==1) {
     return numerator().toString()+".0";
   }
-  float frep = (float) numerator().toInner() /(float) denominator().toInner();
+  float frep = numerator().realDivide(denominator());
   return Int::toString(frep);
   //return toString();
 }
@@ -2199,7 +2518,14 @@ vstring Theory::tryGetInterpretedLaTeXName(unsigned func, bool pred,bool polarit
 }
 
 size_t IntegerConstantType::hash() const {
-  return std::hash<decltype(_val)>{}(_val);
+  if (!_big) {
+    return std::hash<decltype(_val)>{}(_val);
+  }
+  size_t res = _val;
+  for (unsigned i = 0; i < _big->size(); i++) {
+    res = res * 31 + (*_big)[i];
+  }
+  return res;
 }
 
 size_t RationalConstantType::hash() const {
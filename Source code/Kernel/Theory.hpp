@@ -21,6 +21,7 @@
 
 #include "Lib/DHMap.hpp"
 #include "Lib/Exception.hpp"
+#include "Lib/Stack.hpp"
 
 #include "Shell/TermAlgebra.hpp"
 
@@ -50,6 +51,14 @@ public:
   DivByZeroException() : ArithmeticException("divided by zero"){} 
 };
 
+/**
+ * Integers of arbitrary size
+ *
+ * Values that fit into InnerType are stored inline, larger ones in a
+ * heap allocated magnitude. The representation is unique, i.e. a value
+ * is stored in the magnitude only if it does not fit into InnerType, so
+ * only the operations involving big values pay for them.
+ */
 class IntegerConstantType
 {
 public:
@@ -58,11 +67,14 @@ public:
 
   typedef int InnerType;
 
-  IntegerConstantType() {}
-  IntegerConstantType(IntegerConstantType&&) = default;
-  IntegerConstantType(const IntegerConstantType&) = default;
-  IntegerConstantType& operator=(const IntegerConstantType&) = default;
-  constexpr IntegerConstantType(InnerType v) : _val(v) {}
+  IntegerConstantType() : _val(0), _big(0) {}
+  IntegerConstantType(IntegerConstantType&& o) : _val(o._val), _big(o._big) { o._big = 0; }
+  IntegerConstantType(const IntegerConstantType& o)
+  : _val(o._val), _big(o._big ? new Limbs(*o._big) : 0) {}
+  IntegerConstantType& operator=(const IntegerConstantType& o);
+  IntegerConstantType& operator=(IntegerConstantType&& o);
+  ~IntegerConstantType() { if (_big) { delete _big; } }
+  IntegerConstantType(InnerType v) : _val(v), _big(0) {}
   explicit IntegerConstantType(const vstring& str);
 
   IntegerConstantType operator+(const IntegerConstantType& num) const;
@@ -72,11 +84,8 @@ public:
 
   // true if this divides num
   bool divides(const IntegerConstantType& num) const ;
-  float realDivide(const IntegerConstantType& num) const { 
-    if(num._val==0) throw DivByZeroException();
-    return ((float)_val)/num._val; 
-  }
-  int intDivide(const IntegerConstantType& num) const ;  
+  float realDivide(const IntegerConstantType& num) const;
+  IntegerConstantType intDivide(const IntegerConstantType& num) const ;  
   IntegerConstantType remainderE(const IntegerConstantType& num) const; 
   IntegerConstantType quotientE(const IntegerConstantType& num) const; 
   IntegerConstantType quotientT(const IntegerConstantType& num) const;
@@ -95,10 +104,17 @@ public:
   bool operator>=(const IntegerConstantType& o) const { return !(o>(*this)); }
   bool operator<=(const IntegerConstantType& o) const { return !((*this)>o); }
 
-  InnerType toInner() const { return _val; }
+  /** true if the value fits into InnerType */
+  bool fitsInner() const { return !_big; }
+  /** the value, which must fit into InnerType (otherwise MachineArithmeticException is thrown) */
+  InnerType toInner() const { 
+    if (_big) throw MachineArithmeticException();
+    return _val; 
+  }
 
-  bool isZero(){ return _val==0; }
-  bool isNegative(){ return _val<0; }
+  // relies on _val being the sign of a big value
+  bool isZero() const { return _val==0; }
+  bool isNegative() const { return _val<0; }
 
   static IntegerConstantType floor(RationalConstantType rat);
   static IntegerConstantType floor(IntegerConstantType rat);
@@ -106,28 +122,44 @@ public:
   static IntegerConstantType ceiling(RationalConstantType rat);
   static IntegerConstantType ceiling(IntegerConstantType rat);
   IntegerConstantType abs() const;
+  /** greatest common divisor of the absolute values, 1 for two zeros */
+  static IntegerConstantType gcd(const IntegerConstantType& n1, const IntegerConstantType& n2);
+  /** floor of the binary logarithm of the absolute value, 0 for zero */
+  unsigned log2Abs() const;
 
   static Comparison comparePrecedence(IntegerConstantType n1, IntegerConstantType n2);
   size_t hash() const;
 
   vstring toString() const;
 private:
+  /** digits of a magnitude in base 2^32, the least significant one first */
+  typedef Stack<unsigned> Limbs;
+
+  void toSignMagnitude(bool& negative, Limbs& mag) const;
+  static IntegerConstantType fromSignMagnitude(bool negative, Limbs& mag);
+  static void divideT(const IntegerConstantType& n1, const IntegerConstantType& n2,
+                      IntegerConstantType& quotient, IntegerConstantType& remainder);
+  double toDouble() const;
+
+  /** the value if it fits into InnerType, otherwise the sign of the value (1 or -1) */
   InnerType _val;
+  /** magnitude of a value that does not fit into InnerType, otherwise 0 */
+  Limbs* _big;
+
   IntegerConstantType operator/(const IntegerConstantType& num) const;
   IntegerConstantType operator%(const IntegerConstantType& num) const;
 };
 
 inline
 std::ostream& operator<< (ostream& out, const IntegerConstantType& val) {
-  return out << val.toInner();
+  return out << val.toString();
 }
 
 /**
  * A class for representing rational numbers
  *
- * The class uses IntegerConstantType to store the numerator and denominator.
- * This ensures that if there is an overflow in the operations, an exception
- * will be raised by the IntegerConstantType methods.
+ * The class uses IntegerConstantType to store the numerator and denominator,
+ * so they can get arbitrarily big.
  */
 struct RationalConstantType {
   typedef IntegerConstantType InnerType;
@@ -142,7 +174,7 @@ struct RationalConstantType {
 
   RationalConstantType(InnerType num, InnerType den);
   RationalConstantType(const vstring& num, const vstring& den);
-  constexpr RationalConstantType(InnerType num) : _num(num), _den(1) {} //assuming den=1
+  RationalConstantType(InnerType num) : _num(num), _den(1) {} //assuming den=1
 
   RationalConstantType operator+(const RationalConstantType& num) const;
   RationalConstantType operator-(const RationalConstantType& num) const;
@@ -170,10 +202,10 @@ struct RationalConstantType {
   bool operator>=(const RationalConstantType& o) const { return !(o>(*this)); }
   bool operator<=(const RationalConstantType& o) const { return !((*this)>o); }
 
-  bool isZero(){ return _num.toInner()==0; } 
+  bool isZero() const { return _num.isZero(); } 
   // relies on the fact that cannonize ensures that _den>=0
-  bool isNegative() const { ASS(_den>=0); return _num.toInner() < 0; }
-  bool isPositive() const { ASS(_den>=0); return _num.toInner() > 0; }
+  bool isNegative() const { ASS(_den>=0); return _num.isNegative(); }
+  bool isPositive() const { ASS(_den>=0); return !_num.isNegative() && !_num.isZero(); }
 
   RationalConstantType abs() const;
 
@@ -213,9 +245,9 @@ public:
   RealConstantType& operator=(const RealConstantType&) = default;
 
   explicit RealConstantType(const vstring& number);
-  explicit constexpr RealConstantType(const RationalConstantType& rat) : RationalConstantType(rat) {}
+  explicit RealConstantType(const RationalConstantType& rat) : RationalConstantType(rat) {}
   RealConstantType(int num, int den) : RationalConstantType(num, den) {}
-  explicit constexpr RealConstantType(typename IntegerConstantType::InnerType number) : RealConstantType(RationalConstantType(number)) {}
+  explicit RealConstantType(typename IntegerConstantType::InnerType number) : RealConstantType(RationalConstantType(number)) {}
 
   RealConstantType operator+(const RealConstantType& num) const
   { return RealConstantType(RationalConstantType::operator+(num)); }
@@ -90,8 +90,9 @@ int Allocator::_initialised = 0;
 int Allocator::_total = 0;
 size_t Allocator::_memoryLimit;
 size_t Allocator::_tolerated;
+bool Allocator::_releaseFreedPages = false;
 Allocator* Allocator::current;
-Allocator::Page* Allocator::_pages[MAX_PAGES];
+Allocator::Page* Allocator::_pages[MAX_CACHED_PAGES];
 size_t Allocator::_usedMemory = 0;
 Allocator* Allocator::_all[MAX_ALLOCATORS];
 
@@ -145,7 +146,11 @@ Allocator::Allocator()
 #if ! USE_SYSTEM_ALLOCATION
   for (int i = REQUIRES_PAGE/4-1;i >= 0;i--) {
     _freeList[i] = 0;
+    _allocations[i] = 0;
+    _deallocations[i] = 0;
   }
+  _pageAllocations = 0;
+  _pageDeallocations = 0;
   _reserveBytesAvailable = 0;
   _nextAvailableReserve = 0;
   _myPages = 0;
@@ -185,7 +190,7 @@ void Allocator::initialise()
 #if ! USE_SYSTEM_ALLOCATION
   current = newAllocator();
 
-  for (int i = MAX_PAGES-1;i >= 0;i--) {
+  for (int i = MAX_CACHED_PAGES-1;i >= 0;i--) {
     _pages[i] = 0;
   }
 #endif
@@ -267,6 +272,31 @@ void Allocator::reportUsageByClasses()
 
 #endif
 
+/**
+ * Write to @b out, for every allocator, the number of allocated and
+ * currently live pieces of each size class used so far, as well as of
+ * the (multi)pages used for objects of size at least REQUIRES_PAGE.
+ */
+void Allocator::reportUsageBySizeClasses(ostream& out)
+{
+  CALLC("Allocator::reportUsageBySizeClasses",MAKE_CALLS);
+
+  for (int a = 0; a < _total; a++) {
+    Allocator* alloc = _all[a];
+    out << "Allocator " << a << " size classes\n";
+    out << "size\tallocated\tlive\n";
+    for (int i = 0; i < REQUIRES_PAGE/4; i++) {
+      if (!alloc->_allocations[i]) {
+        continue;
+      }
+      out << (i+1)*sizeof(Known) << '\t' << alloc->_allocations[i] << '\t'
+          << alloc->_allocations[i]-alloc->_deallocations[i] << '\n';
+    }
+    out << "pages\t" << alloc->_pageAllocations << '\t'
+        << alloc->_pageAllocations-alloc->_pageDeallocations << '\n';
+  }
+} // Allocator::reportUsageBySizeClasses
+
 /**
  * Cleanup: do whatever needed after the last use of class Allocator.
  * @since 10/01/2008 Manchester
@@ -301,7 +331,7 @@ void Allocator::cleanup()
 #endif
 
   // release all the pages
-  for (int i = MAX_PAGES-1;i >= 0;i--) {
+  for (int i = MAX_CACHED_PAGES-1;i >= 0;i--) {
 #if VDEBUG && TRACE_ALLOCATIONS
     int cnt = 0;
 #endif    
@@ -369,6 +399,7 @@ void Allocator::deallocateKnown(void* obj,size_t size)
 #else   // ! USE_SYSTEM_ALLOCATION
   if (size >= REQUIRES_PAGE) {
     char* mem = reinterpret_cast<char*>(obj)-PAGE_PREFIX_SIZE;
+    _pageDeallocations++;
     deallocatePages(reinterpret_cast<Page*>(mem));
   }
   else {
@@ -376,6 +407,7 @@ void Allocator::deallocateKnown(void* obj,size_t size)
     Known* mem = reinterpret_cast<Known*>(obj);
     mem->next = _freeList[index];
     _freeList[index] = mem;
+    _deallocations[index]++;
   }
 
 #if VDEBUG
@@ -448,6 +480,7 @@ void Allocator::deallocateUnknown(void* obj)
 
   if (size >= REQUIRES_PAGE) {
     mem = mem-PAGE_PREFIX_SIZE;
+    _pageDeallocations++;
     deallocatePages(reinterpret_cast<Page*>(mem));
   }
   else {
@@ -455,6 +488,7 @@ void Allocator::deallocateUnknown(void* obj)
     int index = (size-1)/sizeof(Known);
     known->next = _freeList[index];
     _freeList[index] = known;
+    _deallocations[index]++;
   }
 
 #if WATCH_ADDRESS
@@ -568,26 +602,8 @@ Allocator::Page* Allocator::allocatePages(size_t size)
   size_t index = (size-1)/VPAGE_SIZE;
   size_t realSize = VPAGE_SIZE*(index+1);
 
-  // check if the allocation isn't too big
-  if(index>=MAX_PAGES) {
-#if SAFE_OUT_OF_MEM_SOLUTION
-    env.beginOutput();
-    reportSpiderStatus('m');
-    env.out() << "Unsupported amount of allocated memory: "<<realSize<<"!\n";
-    if(env.statistics) {
-      env.statistics->print(env.out());
-    }
-#if VDEBUG
-    Debug::Tracer::printStack(env.out());
-#endif
-    env.endOutput();
-    System::terminateImmediately(1);
-#else
-    throw Lib::MemoryLimitExceededException();
-#endif
-  }
   // check if there is a page in the list available
-  if (_pages[index]) {
+  if (index < MAX_CACHED_PAGES && _pages[index]) {
     result = _pages[index];
     _pages[index] = result->next;
   }
@@ -714,7 +730,7 @@ void Allocator::deallocatePages(Page* page)
 #endif
 
   size_t size = page->size;
-  int index = (size-1)/VPAGE_SIZE;
+  size_t index = (size-1)/VPAGE_SIZE;
 
   Page* next = page->next;
   if (next) {
@@ -728,8 +744,14 @@ void Allocator::deallocatePages(Page* page)
     _myPages = next;
   }
 
-  page->next = _pages[index];
-  _pages[index] = page;
+  if (_releaseFreedPages || index >= MAX_CACHED_PAGES) {
+    _usedMemory -= size;
+    free(page);
+  }
+  else {
+    page->next = _pages[index];
+    _pages[index] = page;
+  }
 
 #if WATCH_ADDRESS
   unsigned addr = (unsigned)(void*)page;
@@ -830,9 +852,11 @@ char* Allocator::allocatePiece(size_t size)
   if (size >= REQUIRES_PAGE) {
     Page* page = allocatePages(size);
     result = reinterpret_cast<char*>(page) + PAGE_PREFIX_SIZE;
+    _pageAllocations++;
   }
   else { // try to find it in the free list
     int index = (size-1)/sizeof(Known);
+    _allocations[index]++;
     // Align on the pointer basis
     size = (index+1) * sizeof(Known);
     Known* mem = _freeList[index];
@@ -20,6 +20,7 @@
 #define __Allocator__
 
 #include <cstddef>
+#include <iosfwd>
 
 #include "Debug/Assertion.hpp"
 #include "Debug/Tracer.hpp"
@@ -36,18 +37,19 @@
 
 /** Page size in bytes */
 #define VPAGE_SIZE 131000
-/** maximal size of allocated multi-page (in pages) */
-//#define MAX_PAGES 4096
-//#define MAX_PAGES 8192
-#define MAX_PAGES 40000
+/** maximal size (in pages) of a freed multi-page kept by the global manager
+ *  for reuse; larger multi-pages are returned to the system when freed */
+//#define MAX_CACHED_PAGES 4096
+//#define MAX_CACHED_PAGES 8192
+#define MAX_CACHED_PAGES 40000
 /** Any memory piece of this or larger size will be allocated as a page
  *  or contiguous sequence of pages */
 #define REQUIRES_PAGE (VPAGE_SIZE/2)
 /** Maximal allowed number of allocators */
 #define MAX_ALLOCATORS 256
 
-/** The largest piece of memory that can be allocated at once */
-#define MAXIMAL_ALLOCATION (static_cast<unsigned long long>(VPAGE_SIZE)*MAX_PAGES)
+/** The largest piece of memory that can be reused after being freed */
+#define MAXIMAL_CACHED_ALLOCATION (static_cast<unsigned long long>(VPAGE_SIZE)*MAX_CACHED_PAGES)
 
 //this macro is undefined at the end of the file
 // alloc_size follows C notation, for a C++ method, argument 1 is the pointer to this, so
@@ -88,6 +90,14 @@ public:
     _memoryLimit = size;
     _tolerated = size + (size/10);
   }
+  /** If @b release is true, freed (multi)pages are returned to the system
+   *  instead of being kept for reuse */
+  static void setReleaseFreedPages(bool release)
+  {
+    CALLC("Allocator::setReleaseFreedPages",MAKE_CALLS);
+    _releaseFreedPages = release;
+  }
+  static void reportUsageBySizeClasses(std::ostream& out);
   /** The current allocator
    * - through which allocations by the here defined macros are channelled */
   static Allocator* current;
@@ -284,6 +294,8 @@ private:
   /** 10% over the memory limit. When reached, memory de-fragmentation
    *  should occur */
   static size_t _tolerated;
+  /** If true, freed (multi)pages are returned to the system */
+  static bool _releaseFreedPages;
 
   // structures used inside the allocator start here
   /** The free list.
@@ -291,6 +303,14 @@ private:
    * Note that, essentially, sizeof(Known) = sizeof(void*).
    */
   Known* _freeList[REQUIRES_PAGE/4];
+  /** Number of pieces allocated from each size class, indexed as _freeList */
+  size_t _allocations[REQUIRES_PAGE/4];
+  /** Number of pieces returned to each size class, indexed as _freeList */
+  size_t _deallocations[REQUIRES_PAGE/4];
+  /** Number of (multi)pages allocated for objects of size at least REQUIRES_PAGE */
+  size_t _pageAllocations;
+  /** Number of (multi)pages freed by objects of size at least REQUIRES_PAGE */
+  size_t _pageDeallocations;
   /** All pages allocated by this allocator and not returned to 
    *  the global manager via deallocatePages (doubly linked).  */
   Page* _myPages;
@@ -305,7 +325,7 @@ private:
   static size_t _usedMemory;
   /** Page allocator array, a.k.a. "the global manager".
    * Each entry is a (singly linked) list */
-  static Page* _pages[MAX_PAGES];
+  static Page* _pages[MAX_CACHED_PAGES];
 
   friend class Initialiser;
   
@@ -39,7 +39,7 @@
 /**
  * If cache size is greater than this amount of bytes, it will not be expanded
  */
-#define NONEXPANDABLE_CACHE_THRESHOLD MAXIMAL_ALLOCATION/2
+#define NONEXPANDABLE_CACHE_THRESHOLD MAXIMAL_CACHED_ALLOCATION/2
 
 
 namespace Lib {
@@ -51,9 +51,9 @@ using namespace Shell;
 /**
  * Return true if cache size can be expanded to number of bytes @c sz.
  */
-bool canExpandToBytes(size_t sz)
+inline bool canExpandToBytes(size_t sz)
 {
-  return sz<(MAXIMAL_ALLOCATION/2) && sz<(env.options->memoryLimit()-Allocator::getUsedMemory());
+  return sz<(MAXIMAL_CACHED_ALLOCATION/2) && sz<(env.options->memoryLimit()-Allocator::getUsedMemory());
 }
 
 }
@@ -66,7 +66,9 @@ using namespace __Cache_AUX;
  *
  * The number of cache evictions for expansion is two times the size of
  * the cache. On the expansion, elements previously stored in the cache are
- * not copied.
+ * not copied. The cache never expands beyond the maximal size given to the
+ * constructor; from then on a new element replaces the one stored at its
+ * position.
  *
  * Currently the Cache object is used to implement cache in BDD operations.
  */
@@ -80,9 +82,10 @@ private:
     bool _occupied;
   };
 public:
-  Cache() : _size(0), _data(0)
+  /** Create a cache of at most @b maxSize entries, which must be a power of two */
+  explicit Cache(size_t maxSize=SIZE_MAX) : _size(0), _data(0), _maxSize(maxSize)
   {
-    expand(32);
+    expand(min(maxSize, static_cast<size_t>(32)));
   }
 
   ~Cache()
@@ -120,8 +123,7 @@ public:
       }
       _evictionCounter++;
 
-      if(shouldExpand()) {
-	tryExpand();
+      if(shouldExpand() && tryExpand()) {
 	e=_data+getPosition(k);
 	ASS(!e->_occupied);
       }
@@ -154,17 +156,17 @@ private:
     return Hash::hash(k) & _sizeMask;
   }
 
-  /** Expand the cache to double of its current size */
-  void tryExpand()
+  /** Expand the cache to double of its current size, return false if it cannot be expanded */
+  bool tryExpand()
   {
     size_t newSize = _size*2;
-    if(canExpandToBytes(newSize*sizeof(Entry))) {
+    if(newSize<=_maxSize && canExpandToBytes(newSize*sizeof(Entry))) {
       expand(newSize);
+      return true;
     }
-    else {
-      //we will never want to expand again if we cannot expand now
-      _evictionThreshold=SIZE_MAX;
-    }
+    //we will never want to expand again if we cannot expand now
+    _evictionThreshold=SIZE_MAX;
+    return false;
   }
 
   /**
@@ -223,6 +225,9 @@ private:
   /** Array of @b _size entries containing the cached values */
   Entry* _data;
 
+  /** Size beyond which the cache is not expanded */
+  size_t _maxSize;
+
   /**
    * Number of evictions that occurred since the last cache expansion
    */
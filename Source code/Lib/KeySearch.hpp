@@ -0,0 +1,112 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file KeySearch.hpp
+ * Defines class KeySearch of searches in sorted arrays of keys.
+ */
+
+#ifndef __KeySearch__
+#define __KeySearch__
+
+#include <cstddef>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#include "Debug/Assertion.hpp"
+
+/**
+ * Number of keys below which a search stops bisecting and
+ * compares all remaining keys at once
+ */
+#define KEY_SEARCH_WINDOW 32
+
+namespace Lib {
+
+/**
+ * Searches in sorted arrays of unsigned keys, such as the top symbols
+ * of children of index nodes.
+ *
+ * A search bisects the array until at most KEY_SEARCH_WINDOW keys remain
+ * and then counts the keys smaller than the searched one. The counting
+ * uses AVX2 or SSE2 instructions when the compiler targets them, and a
+ * scalar loop otherwise. Since the window is contiguous and small, the
+ * vector compares replace several hard to predict branches of bisection.
+ */
+class KeySearch
+{
+public:
+  /**
+   * Return the number of keys in the sorted array @b keys of length
+   * @b length that are smaller than @b key, i.e. the position of
+   * @b key in the array, or the position where it would be inserted.
+   */
+  static size_t lowerBound(const unsigned* keys, size_t length, unsigned key)
+  {
+    size_t lo=0;
+    size_t hi=length;
+    while(hi-lo>KEY_SEARCH_WINDOW) {
+      size_t mid=(lo+hi)/2;
+      if(keys[mid]<key) {
+        lo=mid+1;
+      } else {
+        hi=mid;
+      }
+    }
+    return lo+countSmaller(keys+lo, hi-lo, key);
+  }
+
+  /** Return the number of keys in @b keys of length @b length smaller than @b key */
+  static size_t countSmaller(const unsigned* keys, size_t length, unsigned key)
+  {
+    size_t i=0;
+    size_t res=0;
+#if defined(__AVX2__)
+    //there are only signed comparisons, so we flip the sign bits
+    const __m256i flip=_mm256_set1_epi32(0x80000000);
+    const __m256i k=_mm256_xor_si256(_mm256_set1_epi32(key),flip);
+    __m256i acc=_mm256_setzero_si256();
+    for(;i+8<=length;i+=8) {
+      __m256i v=_mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys+i)),flip);
+      //the comparison yields -1 in the lanes where the key is smaller
+      acc=_mm256_sub_epi32(acc,_mm256_cmpgt_epi32(k,v));
+    }
+    __m128i acc4=_mm_add_epi32(_mm256_castsi256_si128(acc),_mm256_extracti128_si256(acc,1));
+    acc4=_mm_add_epi32(acc4,_mm_shuffle_epi32(acc4,_MM_SHUFFLE(1,0,3,2)));
+    acc4=_mm_add_epi32(acc4,_mm_shuffle_epi32(acc4,_MM_SHUFFLE(2,3,0,1)));
+    res=static_cast<unsigned>(_mm_cvtsi128_si32(acc4));
+#elif defined(__SSE2__)
+    //there are only signed comparisons, so we flip the sign bits
+    const __m128i flip=_mm_set1_epi32(0x80000000);
+    const __m128i k=_mm_xor_si128(_mm_set1_epi32(key),flip);
+    __m128i acc=_mm_setzero_si128();
+    for(;i+4<=length;i+=4) {
+      __m128i v=_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys+i)),flip);
+      //the comparison yields -1 in the lanes where the key is smaller
+      acc=_mm_sub_epi32(acc,_mm_cmplt_epi32(v,k));
+    }
+    acc=_mm_add_epi32(acc,_mm_shuffle_epi32(acc,_MM_SHUFFLE(1,0,3,2)));
+    acc=_mm_add_epi32(acc,_mm_shuffle_epi32(acc,_MM_SHUFFLE(2,3,0,1)));
+    res=static_cast<unsigned>(_mm_cvtsi128_si32(acc));
+#endif
+    for(;i<length;i++) {
+      res+=keys[i]<key;
+    }
+    ASS_LE(res,length);
+    return res;
+  }
+}; // class KeySearch
+
+}
+
+#endif // __KeySearch__
@@ -239,16 +239,23 @@ void Multiprocessing::killNoCheck(pid_t child, int signal)
   ::kill(child, signal);
 }
 
-pid_t Multiprocessing::poll_children(bool &stopped, bool &exited, bool &signalled, int &code)
+/**
+ * Wait until a child process changes state and return its pid. If @b block
+ * is false, return 0 immediately when no child has changed state.
+ */
+pid_t Multiprocessing::poll_children(bool &stopped, bool &exited, bool &signalled, int &code, bool block)
 {
   CALL("Multiprocessing::poll_child");
 
   int status;
-  pid_t pid = waitpid(-1 /*wait for any child*/, &status, WUNTRACED);
+  pid_t pid = waitpid(-1 /*wait for any child*/, &status, block ? WUNTRACED : WUNTRACED | WNOHANG);
 
   if (pid == -1) {
     SYSTEM_FAIL("Call to waitpid() function failed.", errno);
   }
+  if (!pid) {
+    return 0;
+  }
 
   stopped = WIFSTOPPED(status);
   exited = WIFEXITED(status);
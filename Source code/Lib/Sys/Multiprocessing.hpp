@@ -35,7 +35,7 @@ public:
   void sleep(unsigned ms);
   void kill(pid_t child, int signal);
   void killNoCheck(pid_t child, int signal);
-  pid_t poll_children(bool &stopped, bool &exited, bool &signalled, int &code);
+  pid_t poll_children(bool &stopped, bool &exited, bool &signalled, int &code, bool block=true);
 private:
   Multiprocessing();
   ~Multiprocessing();
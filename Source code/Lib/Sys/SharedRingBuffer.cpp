@@ -0,0 +1,124 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SharedRingBuffer.cpp
+ * Implements class SharedRingBuffer.
+ */
+
+#include <cerrno>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "Lib/Exception.hpp"
+
+#include "SharedRingBuffer.hpp"
+
+namespace Lib
+{
+namespace Sys
+{
+
+/**
+ * Create a buffer for @b slots records of at most @b slotSize words
+ */
+SharedRingBuffer::SharedRingBuffer(unsigned slots, unsigned slotSize)
+: _slots(slots), _slotSize(slotSize), _lock(1)
+{
+  CALL("SharedRingBuffer::SharedRingBuffer");
+  ASS_G(slots,0);
+
+  _size = sizeof(Header) + sizeof(unsigned) * slots * (slotSize + 2);
+
+  errno=0;
+  void* mem = mmap(0, _size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(mem==MAP_FAILED) {
+    SYSTEM_FAIL("Cannot map shared memory.",errno);
+  }
+  _header = static_cast<Header*>(mem);
+  _header->published = 0;
+  _data = reinterpret_cast<unsigned*>(_header + 1);
+
+  _lock.set(0,1);
+}
+
+SharedRingBuffer::~SharedRingBuffer()
+{
+  CALL("SharedRingBuffer::~SharedRingBuffer");
+
+  munmap(_header, _size);
+}
+
+/**
+ * Publish a record of @b length words starting at @b data
+ *
+ * Return false if the record is too long to be published.
+ */
+bool SharedRingBuffer::publish(const unsigned* data, unsigned length)
+{
+  CALL("SharedRingBuffer::publish");
+
+  if(length > _slotSize) {
+    return false;
+  }
+
+  _lock.dec(0);
+  unsigned long position = _header->published;
+  unsigned* s = slot(position);
+  s[0] = getpid();
+  s[1] = length;
+  for(unsigned i=0;i<length;i++) {
+    s[i+2] = data[i];
+  }
+  _header->published = position+1;
+  _lock.inc(0);
+  return true;
+}
+
+/**
+ * Read into @b record the first record published at or after @b position
+ * by a process other than the current one and move @b position past it.
+ *
+ * Return false if there is no such record.
+ */
+bool SharedRingBuffer::read(unsigned long& position, Stack<unsigned>& record)
+{
+  CALL("SharedRingBuffer::read");
+
+  unsigned self = getpid();
+  for(;;) {
+    if(position == published()) {
+      return false;
+    }
+
+    _lock.dec(0);
+    unsigned long last = _header->published;
+    if(last - position > _slots) {
+      // the records in between were overwritten already
+      position = last - _slots;
+    }
+    unsigned* s = slot(position++);
+    bool own = s[0] == self;
+    if(!own) {
+      unsigned length = s[1];
+      record.reset();
+      for(unsigned i=0;i<length;i++) {
+        record.push(s[i+2]);
+      }
+    }
+    _lock.inc(0);
+
+    if(!own) {
+      return true;
+    }
+  }
+}
+
+}
+}
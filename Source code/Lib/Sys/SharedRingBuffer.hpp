@@ -0,0 +1,75 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SharedRingBuffer.hpp
+ * Defines class SharedRingBuffer.
+ */
+
+#ifndef __SharedRingBuffer__
+#define __SharedRingBuffer__
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Semaphore.hpp"
+
+namespace Lib {
+namespace Sys {
+
+/**
+ * A ring buffer of short records (sequences of unsigned words) living in
+ * memory shared by the process that created it and all processes forked
+ * from it afterwards.
+ *
+ * Every process can publish records and read the records published by the
+ * others. When the buffer is full, the oldest records are overwritten, so a
+ * slow reader may miss some of them.
+ */
+class SharedRingBuffer
+{
+public:
+  CLASS_NAME(SharedRingBuffer);
+  USE_ALLOCATOR(SharedRingBuffer);
+
+  SharedRingBuffer(unsigned slots, unsigned slotSize);
+  ~SharedRingBuffer();
+
+  /** Maximal length of a record */
+  unsigned slotSize() const { return _slotSize; }
+  /** Number of records published so far */
+  unsigned long published() const { return _header->published; }
+
+  bool publish(const unsigned* data, unsigned length);
+  bool read(unsigned long& position, Stack<unsigned>& record);
+
+private:
+  struct Header {
+    volatile unsigned long published;
+  };
+
+  unsigned* slot(unsigned long position)
+  { return _data + (position % _slots) * (_slotSize + 2); }
+
+  unsigned _slots;
+  unsigned _slotSize;
+  size_t _size;
+  Header* _header;
+  /** the slots, each being (publisher pid, length, data) */
+  unsigned* _data;
+  /** semaphore 0 locks the buffer */
+  Semaphore _lock;
+};
+
+}
+}
+
+#endif // __SharedRingBuffer__
@@ -324,6 +324,21 @@ void System::registerForSIGHUPOnParentDeath()
 #endif
 }
 
+/**
+ * Make the current process adopt the orphaned descendants of its children,
+ * so that they can be waited for as if they were its own children
+ *
+ * Return false if this is not supported on the current platform.
+ */
+bool System::registerAsChildSubreaper()
+{
+#if __APPLE__ || __CYGWIN__ || !defined(PR_SET_CHILD_SUBREAPER)
+  return false;
+#else
+  return prctl(PR_SET_CHILD_SUBREAPER, 1)==0;
+#endif
+}
+
 /**
  * Read command line arguments into @c res and register the executable name
  * (0-th element of @c argv) using the @c registerArgv0() function.
@@ -60,6 +60,7 @@ public:
   [[noreturn]] static void terminateImmediately(int resultStatus);
 
   static void registerForSIGHUPOnParentDeath();
+  static bool registerAsChildSubreaper();
 
   static void readCmdArgs(int argc, char* argv[], StringStack& res);
 
@@ -365,6 +365,9 @@ void TimeCounter::outputSingleStat(TimeCounterUnit tcu, ostream& out)
   case TC_FMB_CONSTRAINT_CREATION:
     out << "fmb constraint creation";
     break;
+  case TC_FMB_INSTANCE_GENERATION:
+    out << "fmb instance generation";
+    break;
   case TC_HCVI_COMPUTE_HASH:
     out << "hvci compute hash";
     break;
@@ -83,6 +83,7 @@ enum TimeCounterUnit
   TC_FMB_SPLITTING,
   TC_FMB_SAT_SOLVING,
   TC_FMB_CONSTRAINT_CREATION,
+  TC_FMB_INSTANCE_GENERATION,
   TC_HCVI_COMPUTE_HASH,
   TC_HCVI_INSERT,
   TC_HCVI_RETRIEVE,
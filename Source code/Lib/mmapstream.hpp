@@ -0,0 +1,120 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file mmapstream.hpp
+ * Defines class mmapstream, an input stream over a file mapped into memory.
+ */
+
+#ifndef __mmapstream__
+#define __mmapstream__
+
+#include "Portability.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+
+namespace Lib {
+
+/**
+ * Stream buffer whose get area is the whole content of a read-only
+ * memory mapping, so reading never calls into the kernel.
+ *
+ * This only avoids the copy from the kernel into a file buffer; readers
+ * such as the TPTP lexer still copy the characters they consume.
+ */
+class mmapbuf: public std::streambuf
+{
+public:
+  mmapbuf(const char* fileName) : _data(0), _size(0), _mapped(false)
+  {
+    int fd = ::open(fileName, O_RDONLY);
+    if (fd == -1) {
+      return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+      _size = st.st_size;
+      if (_size == 0) {
+        _mapped = true;
+      } else {
+        void* data = mmap(0, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          _data = static_cast<char*>(data);
+          _mapped = true;
+          // let the kernel read ahead while the parser works on the beginning
+          madvise(data, _size, MADV_SEQUENTIAL);
+          madvise(data, _size, MADV_WILLNEED);
+          setg(_data, _data, _data + _size);
+        }
+      }
+    }
+    ::close(fd);
+  }
+
+  ~mmapbuf()
+  {
+    if (_data) {
+      munmap(_data, _size);
+    }
+  }
+
+  /** True if the file content is available through this buffer */
+  bool isMapped() const { return _mapped; }
+
+private:
+  char* _data;
+  size_t _size;
+  bool _mapped;
+};
+
+/**
+ * Input stream reading a file through an mmapbuf
+ *
+ * The stream is in the failed state if the file could not be mapped,
+ * e.g. because it is a pipe, use openInputFile() to fall back to ifstream.
+ */
+class mmapstream: public std::istream
+{
+public:
+  mmapstream(const char* fileName) : std::istream(0), _buf(fileName)
+  {
+    init(&_buf);
+    if (!_buf.isMapped()) {
+      setstate(std::ios_base::failbit);
+    }
+  }
+
+  /**
+   * Open @b fileName for reading, mapping it into memory if possible.
+   * The caller owns the result, which has to be created and deleted
+   * bypassing the Vampire allocator.
+   */
+  static std::istream* openInputFile(const char* fileName)
+  {
+    mmapstream* res = new mmapstream(fileName);
+    if (*res) {
+      return res;
+    }
+    delete res;
+    return new std::ifstream(fileName);
+  }
+
+private:
+  mmapbuf _buf;
+};
+
+}
+
+#endif // __mmapstream__
@@ -69,8 +69,9 @@ void SMTLIB2::parse(istream& str)
 
   LispLexer lex(str);
   LispParser lpar(lex);
-  LExpr* expr = lpar.parse();
-  parse(expr);
+  // process the commands as they are read rather than building the whole tree first
+  LispStreamReader bRdr(lpar);
+  readBenchmark(bRdr);
 }
 
 void SMTLIB2::parse(LExpr* bench)
@@ -78,13 +79,14 @@ void SMTLIB2::parse(LExpr* bench)
   CALL("SMTLIB2::parse(LExpr*)");
 
   ASS(bench->isList());
-  readBenchmark(bench->list);
+  LispListReader bRdr(bench->list);
+  readBenchmark(bRdr);
 }
 
-void SMTLIB2::readBenchmark(LExprList* bench)
+template<class CommandReader>
+void SMTLIB2::readBenchmark(CommandReader& bRdr)
 {
   CALL("SMTLIB2::readBenchmark");
-  LispListReader bRdr(bench);
 
   bool afterCheckSat = false;
 
@@ -579,7 +581,14 @@ void SMTLIB2::readDefineSort(const vstring& name, LExprList* args, LExpr* body)
   // here we could check the definition for well-formed-ness
   // current solution: crash only later, at application site
 
-  ALWAYS(_sortDefinitions.insert(name,SortDefinition(args,body)));
+  // the define-sort command may be destroyed after it was read, keep a copy
+  LExprList* argsCopy = LExprList::copy(args);
+  LExprList::RefIterator it(argsCopy);
+  while (it.hasNext()) {
+    LExpr*& arg = it.next();
+    arg = arg->clone();
+  }
+  ALWAYS(_sortDefinitions.insert(name,SortDefinition(argsCopy,body->clone())));
 }
 
 //  ----------------------------------------------------------------------
@@ -484,9 +484,11 @@ private:
   Set<vstring> _overflow;
 
   /**
-   * Toplevel parsing dispatch for a benchmark.
+   * Toplevel parsing dispatch for a benchmark,
+   * read by a LispListReader or a LispStreamReader.
    */
-  void readBenchmark(LExprList* bench);
+  template<class CommandReader>
+  void readBenchmark(CommandReader& bRdr);
 };
 
 }
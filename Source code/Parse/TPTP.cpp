@@ -21,6 +21,8 @@
 
 #include "Lib/Int.hpp"
 #include "Lib/Environment.hpp"
+#include "Lib/mmapstream.hpp"
+#include "Lib/Timer.hpp"
 
 #include "Kernel/Signature.hpp"
 #include "Kernel/Inference.hpp"
@@ -116,11 +118,14 @@ void TPTP::parse()
 {
   CALL("TPTP::parse");
 
+  int startTime = env.timer->elapsedMilliseconds();
+
   // bulding tokens one by one
   _gpos = 0;
   _cend = 0;
   _tend = 0;
   _lineNumber = 1;
+  _bytesRead = 0;
   _states.push(UNIT_LIST);
   while (!_states.isEmpty()) {
     State s = _states.pop();
@@ -281,6 +286,9 @@ void TPTP::parse()
     cout << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~" << endl << endl;
 #endif
   }
+
+  env.statistics->inputBytes += _bytesRead;
+  env.statistics->parsingTime += env.timer->elapsedMilliseconds() - startTime;
 } // TPTP::parse()
 
 /**
@@ -1242,7 +1250,7 @@ void TPTP::unitList()
     }
     resetChars();
     {
-      BYPASSING_ALLOCATOR; // ifstream was allocated by "system new"
+      BYPASSING_ALLOCATOR; // the stream was allocated by "system new"
       delete _in;
     }
     _in = _inputs.pop();
@@ -2155,7 +2163,8 @@ void TPTP::include()
   vstring fileName(env.options->includeFileName(relativeName));
   {
     BYPASSING_ALLOCATOR; // we cannot make ifstream allocated via Allocator
-    _in = new ifstream(fileName.c_str());
+    // included axiom files can be huge, so map them instead of reading through ifstream
+    _in = mmapstream::openInputFile(fileName.c_str());
   }
   if (!*_in) {
     USER_ERROR((vstring)"cannot open file " + fileName);
@@ -576,6 +576,8 @@ private:
   int _tend;
   /** line number */
   unsigned _lineNumber;
+  /** number of characters read from all inputs */
+  size_t _bytesRead;
   /** The stack of units read */
   UnitStack _units;
   /** stack of unprocessed states */
@@ -671,9 +673,16 @@ private:
     CALL("TPTP::getChar");
 
     while (_cend <= pos) {
-      int c = _in->get();
+      // read from the buffer directly, istream::get() builds a sentry for every character;
+      // the characters are still copied into _chars, tokens are not slices of the input
+      int c = _in->rdbuf()->sbumpc();
       //      if (c == -1) { cout << "<EOF>"; } else {cout << char(c);}
-      _chars[_cend++] = c == -1 ? 0 : c;
+      if (c == -1) {
+        _chars[_cend++] = 0;
+      } else {
+        _chars[_cend++] = c;
+        _bytesRead++;
+      }
     }
     return _chars[pos];
   } // getChar
@@ -0,0 +1,1143 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file CDCLSolver.cpp
+ * Implements class CDCLSolver
+ */
+
+#include <algorithm>
+
+#include "CDCLSolver.hpp"
+
+namespace SAT
+{
+
+using namespace Shell;
+using namespace Lib;
+
+/** learnt clauses with at most this glue are never deleted */
+static const unsigned CORE_GLUE = 2;
+/** learnt clauses with at most this glue are kept while they are used, and vivified */
+static const unsigned TIER2_GLUE = 6;
+/** backjumps longer than this are replaced by chronological backtracking ... */
+static const unsigned CHRONO_DISTANCE = 100;
+/** ... once there have been this many conflicts */
+static const size_t CHRONO_CONFLICTS = 4000;
+/** least number of conflicts between two restarts */
+static const size_t RESTART_MIN_CONFLICTS = 20;
+/** restart when the recent average glue exceeds the long term one by this factor */
+static const double RESTART_MARGIN = 1.15;
+
+const CDCLSolver::Lit CDCLSolver::NO_LIT;
+const CDCLSolver::CRef CDCLSolver::NO_CLAUSE;
+
+CDCLSolver::CDCLSolver(const Shell::Options& opts, bool generateProofs)
+: _status(SATISFIABLE), _unsat(false), _varCnt(0), _wasted(0), _qhead(0), _varInc(1),
+  _conflicts(0), _propagations(0), _conflictsAtRestart(0), _nextReduce(2000), _reductions(0),
+  _vivifiedAtPropagations(0), _simplifiedTrail(0), _glueFast(0), _glueSlow(0), _stamp(0)
+{
+  CALL("CDCLSolver::CDCLSolver");
+
+  // variable 0 is not used
+  ensureVarCount(0);
+}
+
+void CDCLSolver::ensureVarCount(unsigned newVarCnt)
+{
+  CALL("CDCLSolver::ensureVarCount");
+
+  if (newVarCnt < _varCnt) {
+    return;
+  }
+  unsigned oldCnt = _varCnt;
+  _varCnt = newVarCnt;
+
+  _value.expand(2*(_varCnt+1), VAL_UNDEF);
+  _watches.expand(2*(_varCnt+1));
+  _level.expand(_varCnt+1, 0);
+  _reason.expand(_varCnt+1, NO_CLAUSE);
+  _phase.expand(_varCnt+1, 0);
+  _activity.expand(_varCnt+1, 0);
+  _seen.expand(_varCnt+1, 0);
+  _heapIndex.expand(_varCnt+1, -1);
+
+  for (unsigned v = oldCnt+1; v <= _varCnt; v++) {
+    heapInsert(v);
+  }
+}
+
+unsigned CDCLSolver::newVar()
+{
+  CALL("CDCLSolver::newVar");
+
+  ensureVarCount(_varCnt+1);
+  return _varCnt;
+}
+
+void CDCLSolver::addAssumption(SATLiteral lit)
+{
+  CALL("CDCLSolver::addAssumption");
+
+  _assumptions.push(toLit(lit));
+}
+
+/**
+ * Add clause into the solver.
+ *
+ * The clause is simplified by the zero-implied literals, units are
+ * only put on the trail and get propagated by the next call to solve.
+ */
+void CDCLSolver::addClause(SATClause* cl)
+{
+  CALL("CDCLSolver::addClause");
+
+  // store to later generate the refutation
+  PrimitiveProofRecordingSATSolver::addClause(cl);
+
+  ASS(_assumptions.isEmpty());
+  ASS_EQ(decisionLevel(),0);
+
+  if (_unsat) {
+    return;
+  }
+
+  _learnt.reset();
+  bool satisfied = false;
+  unsigned clen = cl->length();
+  for (unsigned i = 0; i < clen; i++) {
+    Lit l = toLit((*cl)[i]);
+    ASS_G(litVar(l),0); ASS_LE(litVar(l),_varCnt);
+
+    if (_value[l] == VAL_TRUE || _seen[litVar(l)] == (char)(2 - (l&1))) {
+      // satisfied or a tautology
+      satisfied = true;
+      break;
+    }
+    if (_value[l] == VAL_FALSE || _seen[litVar(l)]) {
+      continue;
+    }
+    // 1 marks a positive and 2 a negative occurrence
+    _seen[litVar(l)] = 1 + (l&1);
+    _learnt.push(l);
+  }
+  for (unsigned i = 0; i < _learnt.size(); i++) {
+    _seen[litVar(_learnt[i])] = 0;
+  }
+  if (satisfied) {
+    return;
+  }
+
+  if (_learnt.isEmpty()) {
+    _unsat = true;
+  } else if (_learnt.size() == 1) {
+    enqueue(_learnt[0], 0, NO_CLAUSE);
+  } else {
+    CRef c = allocClause(_learnt, false, 0);
+    _clauses.push(c);
+    attachClause(c);
+  }
+}
+
+CDCLSolver::CRef CDCLSolver::allocClause(const Stack<Lit>& lits, bool learnt, unsigned glue)
+{
+  CALL("CDCLSolver::allocClause");
+  ASS_GE(lits.size(),2);
+
+  CRef c = _arena.size();
+  _arena.push(lits.size());
+  _arena.push((learnt ? LEARNT : 0) | (glue << GLUE_SHIFT));
+  for (unsigned i = 0; i < lits.size(); i++) {
+    _arena.push(lits[i]);
+  }
+  return c;
+}
+
+void CDCLSolver::attachClause(CRef c)
+{
+  Lit* lits = clLits(c);
+  _watches[lits[0]].push(Watch(c,lits[1]));
+  _watches[lits[1]].push(Watch(c,lits[0]));
+}
+
+/**
+ * Mark clause as deleted. Its watches are dropped lazily by propagate
+ * and the memory is reclaimed by collectGarbage.
+ */
+void CDCLSolver::deleteClause(CRef c)
+{
+  ASS(!clHas(c,DELETED));
+  ASS(!isLocked(c));
+
+  clSet(c,DELETED);
+  _wasted += HEADER + clSize(c);
+}
+
+/**
+ * True if the clause is the reason of an assigned literal
+ * (which is always the first literal of the clause).
+ */
+bool CDCLSolver::isLocked(CRef c) const
+{
+  Lit first = clLits(c)[0];
+  return _value[first] == VAL_TRUE && _reason[litVar(first)] == c;
+}
+
+/**
+ * Compact _arena, dropping the deleted clauses, and rebuild all the watches.
+ */
+void CDCLSolver::collectGarbage()
+{
+  CALL("CDCLSolver::collectGarbage");
+
+  Stack<unsigned> arena(_arena.size() - _wasted);
+  // the flags word of every old clause is overwritten by its new position
+  for (CRef c = 0; c < _arena.size(); c += HEADER + _arena[c]) {
+    if (clHas(c,DELETED)) {
+      _arena[c+1] = NO_CLAUSE;
+      continue;
+    }
+    CRef nc = arena.size();
+    for (unsigned i = 0; i < HEADER + clSize(c); i++) {
+      arena.push(_arena[c+i]);
+    }
+    _arena[c+1] = nc;
+  }
+
+  for (unsigned i = 0; i < _trail.size(); i++) {
+    unsigned v = litVar(_trail[i]);
+    if (_reason[v] != NO_CLAUSE) {
+      _reason[v] = _arena[_reason[v]+1];
+      ASS_NEQ(_reason[v],NO_CLAUSE);
+    }
+  }
+  Stack<CRef>* lists[] = { &_clauses, &_learnts };
+  for (Stack<CRef>* list : lists) {
+    unsigned j = 0;
+    for (unsigned i = 0; i < list->size(); i++) {
+      CRef nc = _arena[(*list)[i]+1];
+      if (nc != NO_CLAUSE) {
+        (*list)[j++] = nc;
+      }
+    }
+    list->truncate(j);
+  }
+
+  std::swap(_arena, arena);
+  _wasted = 0;
+
+  for (unsigned l = 0; l < _watches.size(); l++) {
+    _watches[l].reset();
+  }
+  Stack<CRef>::Iterator cit(_clauses);
+  while (cit.hasNext()) {
+    attachClause(cit.next());
+  }
+  Stack<CRef>::Iterator lit(_learnts);
+  while (lit.hasNext()) {
+    attachClause(lit.next());
+  }
+}
+
+void CDCLSolver::enqueue(Lit l, unsigned level, CRef reason)
+{
+  ASS_EQ(_value[l],VAL_UNDEF);
+
+  _value[l] = VAL_TRUE;
+  _value[negLit(l)] = VAL_FALSE;
+  _level[litVar(l)] = level;
+  _reason[litVar(l)] = reason;
+  _trail.push(l);
+}
+
+/**
+ * Undo the assignments above @b level. With chronological backtracking
+ * the trail is not sorted by levels, so the literals of lower levels
+ * assigned later are kept (and propagated again).
+ */
+void CDCLSolver::backtrack(unsigned level)
+{
+  if (decisionLevel() <= level) {
+    return;
+  }
+
+  _keptOnTrail.reset();
+  size_t start = _trailLim[level];
+  for (size_t i = _trail.size(); i > start; ) {
+    i--;
+    Lit l = _trail[i];
+    unsigned v = litVar(l);
+    if (_level[v] <= level) {
+      _keptOnTrail.push(l);
+    } else {
+      _value[l] = VAL_UNDEF;
+      _value[negLit(l)] = VAL_UNDEF;
+      _phase[v] = (l&1) ? 0 : 1;
+      heapInsert(v);
+    }
+  }
+  _trail.truncate(start);
+  _trailLim.truncate(level);
+  _qhead = start;
+  while (_keptOnTrail.isNonEmpty()) {
+    _trail.push(_keptOnTrail.pop());
+  }
+}
+
+/**
+ * Propagate the literals on the trail, return a conflicting clause
+ * or NO_CLAUSE.
+ *
+ * An implied literal gets the highest level of the other literals
+ * of its reason, which may be lower than the current decision level.
+ */
+CDCLSolver::CRef CDCLSolver::propagate()
+{
+  CRef confl = NO_CLAUSE;
+
+  while (_qhead < _trail.size()) {
+    Lit p = _trail[_qhead++];
+    Lit falseLit = negLit(p);
+    unsigned pLevel = _level[litVar(p)];
+    Stack<Watch>& ws = _watches[falseLit];
+    _propagations++;
+
+    Watch* i = ws.begin();
+    Watch* j = i;
+    Watch* end = ws.end();
+    while (i != end) {
+      Watch w = *i++;
+      if (_value[w.blocker] == VAL_TRUE) {
+        *j++ = w;
+        continue;
+      }
+      CRef c = w.cref;
+      if (clHas(c,DELETED)) {
+        continue;
+      }
+      Lit* lits = clLits(c);
+      if (lits[0] == falseLit) {
+        lits[0] = lits[1];
+        lits[1] = falseLit;
+      }
+      ASS_EQ(lits[1],falseLit);
+
+      Lit first = lits[0];
+      Watch nw(c,first);
+      if (first != w.blocker && _value[first] == VAL_TRUE) {
+        *j++ = nw;
+        continue;
+      }
+
+      unsigned size = clSize(c);
+      bool moved = false;
+      for (unsigned k = 2; k < size; k++) {
+        if (_value[lits[k]] != VAL_FALSE) {
+          lits[1] = lits[k];
+          lits[k] = falseLit;
+          _watches[lits[1]].push(nw);
+          moved = true;
+          break;
+        }
+      }
+      if (moved) {
+        continue;
+      }
+
+      *j++ = nw;
+      if (_value[first] == VAL_FALSE) {
+        confl = c;
+        _qhead = _trail.size();
+        while (i != end) {
+          *j++ = *i++;
+        }
+        break;
+      }
+
+      unsigned level = pLevel;
+      if (level != decisionLevel()) {
+        // watch the false literal of the highest level, so that the
+        // clause gets visited when backtracking unassigns first
+        unsigned maxIdx = 1;
+        for (unsigned k = 2; k < size; k++) {
+          if (_level[litVar(lits[k])] > level) {
+            level = _level[litVar(lits[k])];
+            maxIdx = k;
+          }
+        }
+        if (maxIdx != 1) {
+          std::swap(lits[1],lits[maxIdx]);
+          j--;
+          _watches[lits[1]].push(nw);
+        }
+      }
+      enqueue(first, level, c);
+    }
+    ws.truncate(j-ws.begin());
+    if (confl != NO_CLAUSE) {
+      break;
+    }
+  }
+  return confl;
+}
+
+/**
+ * Move the literals of the highest level of the conflict to the front
+ * of the clause and return the level. @b singleTop is set if only one
+ * literal has the highest level; in that case the second literal
+ * has the second highest level.
+ */
+unsigned CDCLSolver::prepareConflict(CRef confl, bool& singleTop)
+{
+  Lit* lits = clLits(confl);
+  unsigned size = clSize(confl);
+
+  unsigned top = _level[litVar(lits[0])];
+  if (top == decisionLevel() && _level[litVar(lits[1])] == top) {
+    singleTop = false;
+    return top;
+  }
+
+  // positions of the literals with the highest and the second highest level
+  unsigned idx0 = 0;
+  for (unsigned k = 1; k < size; k++) {
+    if (_level[litVar(lits[k])] > _level[litVar(lits[idx0])]) {
+      idx0 = k;
+    }
+  }
+  unsigned idx1 = (idx0 == 0) ? 1 : 0;
+  for (unsigned k = idx1+1; k < size; k++) {
+    if (k != idx0 && _level[litVar(lits[k])] > _level[litVar(lits[idx1])]) {
+      idx1 = k;
+    }
+  }
+  top = _level[litVar(lits[idx0])];
+  singleTop = _level[litVar(lits[idx1])] < top;
+
+  // the two literals become the watched ones
+  Lit l0 = lits[idx0];
+  Lit l1 = lits[idx1];
+  for (unsigned pos = 0; pos < 2; pos++) {
+    if (pos == idx0 || pos == idx1) {
+      continue;
+    }
+    Stack<Watch>& ws = _watches[lits[pos]];
+    for (unsigned i = 0; i < ws.size(); i++) {
+      if (ws[i].cref == confl) {
+        ws[i] = ws.top();
+        ws.pop();
+        break;
+      }
+    }
+  }
+  if (idx0 >= 2) {
+    _watches[l0].push(Watch(confl,l1));
+  }
+  if (idx1 >= 2) {
+    _watches[l1].push(Watch(confl,l0));
+  }
+  std::swap(lits[0],lits[idx0]);
+  std::swap(lits[1],lits[idx1 == 0 ? idx0 : idx1]);
+  ASS_EQ(lits[0],l0);
+  ASS_EQ(lits[1],l1);
+  return top;
+}
+
+/**
+ * Derive the first UIP clause of the conflict into _learnt, the asserting
+ * literal first and a literal of @b btLevel second.
+ */
+void CDCLSolver::analyze(CRef confl, unsigned conflLevel, unsigned& btLevel, unsigned& glue)
+{
+  _learnt.reset();
+  _learnt.push(NO_LIT);
+
+  int pathCnt = 0;
+  Lit p = NO_LIT;
+  size_t index = _trail.size();
+
+  do {
+    ASS_NEQ(confl,NO_CLAUSE);
+    if (clHas(confl,LEARNT)) {
+      clSet(confl,USED);
+      unsigned g = clGlue(confl);
+      if (g > CORE_GLUE) {
+        unsigned ng = computeGlue(clLits(confl),clSize(confl));
+        if (ng < g) {
+          clSetGlue(confl,ng);
+        }
+      }
+    }
+
+    Lit* lits = clLits(confl);
+    unsigned size = clSize(confl);
+    for (unsigned k = (p == NO_LIT) ? 0 : 1; k < size; k++) {
+      Lit q = lits[k];
+      unsigned v = litVar(q);
+      if (!_seen[v] && _level[v] > 0) {
+        bumpVar(v);
+        _seen[v] = 1;
+        if (_level[v] >= conflLevel) {
+          pathCnt++;
+        } else {
+          _learnt.push(q);
+        }
+      }
+    }
+
+    // the next literal of the conflict level to resolve on
+    do {
+      do {
+        index--;
+      } while (!_seen[litVar(_trail[index])]);
+      p = _trail[index];
+    } while (_level[litVar(p)] < conflLevel);
+
+    confl = _reason[litVar(p)];
+    _seen[litVar(p)] = 0;
+    pathCnt--;
+  } while (pathCnt > 0);
+  _learnt[0] = negLit(p);
+
+  // minimization
+  _toClear.reset();
+  unsigned abstractLevels = 0;
+  for (unsigned i = 1; i < _learnt.size(); i++) {
+    _toClear.push(_learnt[i]);
+    abstractLevels |= 1u << (_level[litVar(_learnt[i])] & 31);
+  }
+  unsigned j = 1;
+  for (unsigned i = 1; i < _learnt.size(); i++) {
+    Lit l = _learnt[i];
+    if (_reason[litVar(l)] == NO_CLAUSE || !litRedundant(l,abstractLevels)) {
+      _learnt[j++] = l;
+    }
+  }
+  _learnt.truncate(j);
+  for (unsigned i = 0; i < _toClear.size(); i++) {
+    _seen[litVar(_toClear[i])] = 0;
+  }
+
+  btLevel = 0;
+  if (_learnt.size() > 1) {
+    unsigned maxIdx = 1;
+    for (unsigned i = 2; i < _learnt.size(); i++) {
+      if (_level[litVar(_learnt[i])] > _level[litVar(_learnt[maxIdx])]) {
+        maxIdx = i;
+      }
+    }
+    std::swap(_learnt[1],_learnt[maxIdx]);
+    btLevel = _level[litVar(_learnt[1])];
+  }
+  glue = computeGlue(_learnt.begin(),_learnt.size());
+}
+
+/**
+ * True if @b p is implied by the other literals of the learnt clause.
+ * @b abstractLevels over-approximates the levels of those literals.
+ */
+bool CDCLSolver::litRedundant(Lit p, unsigned abstractLevels)
+{
+  _redundantStack.reset();
+  _redundantStack.push(p);
+  size_t top = _toClear.size();
+
+  while (_redundantStack.isNonEmpty()) {
+    CRef c = _reason[litVar(_redundantStack.pop())];
+    ASS_NEQ(c,NO_CLAUSE);
+    Lit* lits = clLits(c);
+    unsigned size = clSize(c);
+    for (unsigned k = 1; k < size; k++) {
+      Lit q = lits[k];
+      unsigned v = litVar(q);
+      if (_seen[v] || _level[v] == 0) {
+        continue;
+      }
+      if (_reason[v] != NO_CLAUSE && (abstractLevels & (1u << (_level[v] & 31)))) {
+        _seen[v] = 1;
+        _redundantStack.push(q);
+        _toClear.push(q);
+      } else {
+        for (size_t i = top; i < _toClear.size(); i++) {
+          _seen[litVar(_toClear[i])] = 0;
+        }
+        _toClear.truncate(top);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Return the number of distinct decision levels among the literals.
+ */
+unsigned CDCLSolver::computeGlue(const Lit* lits, unsigned size)
+{
+  if (_levelStamp.size() <= decisionLevel()) {
+    _levelStamp.expand(decisionLevel()+1, 0);
+  }
+  _stamp++;
+  unsigned glue = 0;
+  for (unsigned i = 0; i < size; i++) {
+    unsigned lev = _level[litVar(lits[i])];
+    if (_levelStamp[lev] != _stamp) {
+      _levelStamp[lev] = _stamp;
+      glue++;
+    }
+  }
+  return glue;
+}
+
+/**
+ * Collect into _failedAssumptions the assumptions which imply
+ * that the assumption @b falseAssumption is false (including itself).
+ */
+void CDCLSolver::analyzeFinal(Lit falseAssumption)
+{
+  CALL("CDCLSolver::analyzeFinal");
+
+  _failedAssumptions.reset();
+  _failedAssumptions.push(toSATLiteral(falseAssumption));
+
+  if (decisionLevel() == 0 || _level[litVar(falseAssumption)] == 0) {
+    // chronological backtracking leaves the units learnt above the first
+    // assumption on the trail, these are no assumptions
+    return;
+  }
+  _seen[litVar(falseAssumption)] = 1;
+  for (size_t i = _trail.size(); i > _trailLim[0]; ) {
+    i--;
+    unsigned v = litVar(_trail[i]);
+    if (!_seen[v]) {
+      continue;
+    }
+    if (_reason[v] == NO_CLAUSE) {
+      // only assumptions are decided below decisionLevel()
+      ASS_G(_level[v],0);
+      _failedAssumptions.push(toSATLiteral(_trail[i]));
+    } else {
+      Lit* lits = clLits(_reason[v]);
+      unsigned size = clSize(_reason[v]);
+      for (unsigned k = 1; k < size; k++) {
+        if (_level[litVar(lits[k])] > 0) {
+          _seen[litVar(lits[k])] = 1;
+        }
+      }
+    }
+    _seen[v] = 0;
+  }
+  _seen[litVar(falseAssumption)] = 0;
+}
+
+void CDCLSolver::bumpVar(unsigned v)
+{
+  if ((_activity[v] += _varInc) > 1e100) {
+    for (unsigned u = 1; u <= _varCnt; u++) {
+      _activity[u] *= 1e-100;
+    }
+    _varInc *= 1e-100;
+  }
+  if (_heapIndex[v] >= 0) {
+    heapUp(_heapIndex[v]);
+  }
+}
+
+void CDCLSolver::heapInsert(unsigned v)
+{
+  if (_heapIndex[v] >= 0) {
+    return;
+  }
+  _heapIndex[v] = _heap.size();
+  _heap.push(v);
+  heapUp(_heap.size()-1);
+}
+
+void CDCLSolver::heapUp(unsigned pos)
+{
+  unsigned v = _heap[pos];
+  while (pos > 0) {
+    unsigned parent = (pos-1) >> 1;
+    if (!heapLess(v,_heap[parent])) {
+      break;
+    }
+    _heap[pos] = _heap[parent];
+    _heapIndex[_heap[pos]] = pos;
+    pos = parent;
+  }
+  _heap[pos] = v;
+  _heapIndex[v] = pos;
+}
+
+void CDCLSolver::heapDown(unsigned pos)
+{
+  unsigned v = _heap[pos];
+  unsigned size = _heap.size();
+  for (;;) {
+    unsigned child = 2*pos+1;
+    if (child >= size) {
+      break;
+    }
+    if (child+1 < size && heapLess(_heap[child+1],_heap[child])) {
+      child++;
+    }
+    if (!heapLess(_heap[child],v)) {
+      break;
+    }
+    _heap[pos] = _heap[child];
+    _heapIndex[_heap[pos]] = pos;
+    pos = child;
+  }
+  _heap[pos] = v;
+  _heapIndex[v] = pos;
+}
+
+unsigned CDCLSolver::heapPop()
+{
+  ASS(_heap.isNonEmpty());
+
+  unsigned res = _heap[0];
+  _heapIndex[res] = -1;
+  unsigned last = _heap.pop();
+  if (_heap.isNonEmpty()) {
+    _heap[0] = last;
+    _heapIndex[last] = 0;
+    heapDown(0);
+  }
+  return res;
+}
+
+CDCLSolver::Lit CDCLSolver::pickBranchLit()
+{
+  while (_heap.isNonEmpty()) {
+    unsigned v = heapPop();
+    if (_value[2*v] == VAL_UNDEF) {
+      return _phase[v] ? 2*v : 2*v+1;
+    }
+  }
+  return NO_LIT;
+}
+
+/**
+ * Restart when the glue of the recently learnt clauses is
+ * noticeably worse than the long term average.
+ */
+bool CDCLSolver::shouldRestart()
+{
+  return _conflicts - _conflictsAtRestart >= RESTART_MIN_CONFLICTS &&
+    _glueFast > RESTART_MARGIN * _glueSlow;
+}
+
+/**
+ * Delete clauses satisfied by the zero-implied literals.
+ */
+void CDCLSolver::removeSatisfied()
+{
+  CALL("CDCLSolver::removeSatisfied");
+  ASS_EQ(decisionLevel(),0);
+
+  if (_trail.size() == _simplifiedTrail) {
+    return;
+  }
+  _simplifiedTrail = _trail.size();
+
+  Stack<CRef>* lists[] = { &_clauses, &_learnts };
+  for (Stack<CRef>* list : lists) {
+    unsigned j = 0;
+    for (unsigned i = 0; i < list->size(); i++) {
+      CRef c = (*list)[i];
+      if (clHas(c,DELETED)) {
+        continue;
+      }
+      if (!isLocked(c)) {
+        Lit* lits = clLits(c);
+        unsigned size = clSize(c);
+        unsigned k = 0;
+        while (k < size && _value[lits[k]] != VAL_TRUE) {
+          k++;
+        }
+        if (k < size) {
+          deleteClause(c);
+          continue;
+        }
+      }
+      (*list)[j++] = c;
+    }
+    list->truncate(j);
+  }
+  if (2*_wasted > _arena.size()) {
+    collectGarbage();
+  }
+}
+
+/**
+ * Learnt clauses with glue at most CORE_GLUE are kept forever.
+ * The others survive if they were used since the last reduction,
+ * and the better half of the rest is kept too.
+ */
+void CDCLSolver::reduceLearnts()
+{
+  CALL("CDCLSolver::reduceLearnts");
+
+  _reductions++;
+  _nextReduce = _conflicts + 2000 + 300*_reductions;
+
+  Stack<CRef> candidates;
+  unsigned j = 0;
+  for (unsigned i = 0; i < _learnts.size(); i++) {
+    CRef c = _learnts[i];
+    if (clHas(c,DELETED)) {
+      continue;
+    }
+    _learnts[j++] = c;
+    if (clGlue(c) <= CORE_GLUE) {
+      continue;
+    }
+    if (clHas(c,USED)) {
+      clClear(c,USED);
+      continue;
+    }
+    if (!isLocked(c)) {
+      candidates.push(c);
+    }
+  }
+  _learnts.truncate(j);
+
+  std::sort(candidates.begin(), candidates.end(), [this](CRef c1, CRef c2) {
+    if (clGlue(c1) != clGlue(c2)) {
+      return clGlue(c1) > clGlue(c2);
+    }
+    return clSize(c1) > clSize(c2);
+  });
+  for (unsigned i = 0; i < candidates.size()/2; i++) {
+    deleteClause(candidates[i]);
+  }
+
+  if (2*_wasted > _arena.size()) {
+    collectGarbage();
+  }
+}
+
+/**
+ * Try to shorten the low glue learnt clauses. The negations of the
+ * literals of a clause are decided one by one (at level 0); the
+ * literals after a conflict or after a literal which got implied true
+ * can be dropped, as can those which got implied false.
+ */
+void CDCLSolver::vivifyLearnts()
+{
+  CALL("CDCLSolver::vivifyLearnts");
+  ASS_EQ(decisionLevel(),0);
+
+  // spend about a tenth of the propagations
+  size_t budget = std::max((size_t)20000, (_propagations - _vivifiedAtPropagations) / 10);
+  size_t stopAt = _propagations + budget;
+
+  Stack<Lit> lits;
+  size_t cnt = _learnts.size();
+  for (size_t i = 0; i < cnt && _propagations < stopAt; i++) {
+    CRef c = _learnts[i];
+    if (clHas(c,DELETED) || clHas(c,VIVIFIED) || clGlue(c) > TIER2_GLUE ||
+        clSize(c) <= 2 || isLocked(c)) {
+      continue;
+    }
+    clSet(c,VIVIFIED);
+
+    lits.reset();
+    for (unsigned k = 0; k < clSize(c); k++) {
+      lits.push(clLits(c)[k]);
+    }
+
+    bool satisfied = false;
+    _learnt.reset();
+    for (unsigned k = 0; k < lits.size(); k++) {
+      Lit l = lits[k];
+      if (_value[l] == VAL_TRUE) {
+        if (_level[litVar(l)] == 0) {
+          satisfied = true;
+        } else {
+          _learnt.push(l);
+        }
+        break;
+      }
+      if (_value[l] == VAL_FALSE) {
+        continue;
+      }
+      _learnt.push(l);
+      newDecisionLevel();
+      enqueue(negLit(l), decisionLevel(), NO_CLAUSE);
+      if (propagate() != NO_CLAUSE) {
+        break;
+      }
+    }
+    backtrack(0);
+
+    if (isLocked(c)) {
+      // became the reason of a zero-implied literal
+      continue;
+    }
+    if (satisfied) {
+      deleteClause(c);
+      continue;
+    }
+    if (_learnt.size() == lits.size()) {
+      continue;
+    }
+    ASS(_learnt.isNonEmpty());
+    unsigned glue = std::min(clGlue(c), (unsigned)_learnt.size()-1);
+    deleteClause(c);
+    if (_learnt.size() == 1) {
+      if (_value[_learnt[0]] == VAL_UNDEF) {
+        enqueue(_learnt[0], 0, NO_CLAUSE);
+        if (propagate() != NO_CLAUSE) {
+          _unsat = true;
+          return;
+        }
+      }
+      continue;
+    }
+    CRef nc = allocClause(_learnt, true, glue);
+    clSet(nc,VIVIFIED);
+    _learnts.push(nc);
+    attachClause(nc);
+  }
+  _vivifiedAtPropagations = _propagations;
+
+  if (2*_wasted > _arena.size()) {
+    collectGarbage();
+  }
+}
+
+/**
+ * Run the CDCL loop until the satisfiability under the assumptions
+ * is established or @b conflictCountLimit conflicts are reached.
+ */
+SATSolver::Status CDCLSolver::search(unsigned conflictCountLimit)
+{
+  CALL("CDCLSolver::search");
+
+  size_t conflictsAtStart = _conflicts;
+
+  for (;;) {
+    CRef confl = propagate();
+    if (confl != NO_CLAUSE) {
+      _conflicts++;
+
+      bool singleTop;
+      unsigned conflLevel = prepareConflict(confl, singleTop);
+      if (conflLevel == 0) {
+        _unsat = true;
+        return UNSATISFIABLE;
+      }
+      if (singleTop) {
+        // the clause is not a conflict one level lower, but it is unit there
+        backtrack(conflLevel-1);
+        Lit* lits = clLits(confl);
+        enqueue(lits[0], _level[litVar(lits[1])], confl);
+        continue;
+      }
+
+      unsigned btLevel, glue;
+      analyze(confl, conflLevel, btLevel, glue);
+
+      if (_conflicts > CHRONO_CONFLICTS && conflLevel - btLevel > CHRONO_DISTANCE) {
+        backtrack(conflLevel-1);
+      } else {
+        backtrack(btLevel);
+      }
+
+      if (_learnt.size() == 1) {
+        enqueue(_learnt[0], 0, NO_CLAUSE);
+      } else {
+        CRef c = allocClause(_learnt, true, glue);
+        _learnts.push(c);
+        attachClause(c);
+        enqueue(_learnt[0], btLevel, c);
+      }
+      decayActivities();
+
+      double fastAlpha = std::max(1.0/32, 1.0/_conflicts);
+      double slowAlpha = std::max(1.0/5000, 1.0/_conflicts);
+      _glueFast += fastAlpha * (glue - _glueFast);
+      _glueSlow += slowAlpha * (glue - _glueSlow);
+      continue;
+    }
+
+    if (conflictCountLimit != UINT_MAX && _conflicts - conflictsAtStart >= conflictCountLimit) {
+      return UNKNOWN;
+    }
+
+    if (shouldRestart() || _conflicts >= _nextReduce) {
+      _conflictsAtRestart = _conflicts;
+      backtrack(0);
+    }
+    if (decisionLevel() == 0) {
+      if (_conflicts >= _nextReduce) {
+        reduceLearnts();
+        vivifyLearnts();
+        if (_unsat) {
+          return UNSATISFIABLE;
+        }
+        if (_qhead < _trail.size()) {
+          continue;
+        }
+      }
+      removeSatisfied();
+    }
+
+    Lit next = NO_LIT;
+    while (decisionLevel() < _assumptions.size()) {
+      Lit a = _assumptions[decisionLevel()];
+      if (_value[a] == VAL_TRUE) {
+        // a dummy level to keep the levels and assumptions in sync
+        newDecisionLevel();
+      } else if (_value[a] == VAL_FALSE) {
+        analyzeFinal(a);
+        return UNSATISFIABLE;
+      } else {
+        next = a;
+        break;
+      }
+    }
+    if (next == NO_LIT) {
+      next = pickBranchLit();
+      if (next == NO_LIT) {
+        return SATISFIABLE;
+      }
+    }
+    newDecisionLevel();
+    enqueue(next, decisionLevel(), NO_CLAUSE);
+  }
+}
+
+SATSolver::Status CDCLSolver::solve(unsigned conflictCountLimit)
+{
+  CALL("CDCLSolver::solve");
+
+  _failedAssumptions.reset();
+  if (_unsat) {
+    _status = UNSATISFIABLE;
+    return _status;
+  }
+
+  _status = search(conflictCountLimit);
+
+  if (_status == SATISFIABLE) {
+    _model.expand(_varCnt+1);
+    for (unsigned v = 1; v <= _varCnt; v++) {
+      _model[v] = _value[2*v] == VAL_TRUE;
+    }
+#if VDEBUG
+    assertModel();
+#endif
+  }
+  backtrack(0);
+  return _status;
+}
+
+SATSolver::Status CDCLSolver::solveUnderAssumptions(const SATLiteralStack& assumps, unsigned conflictCountLimit, bool)
+{
+  CALL("CDCLSolver::solveUnderAssumptions");
+
+  ASS(!hasAssumptions());
+
+  SATLiteralStack::ConstIterator it(assumps);
+  while (it.hasNext()) {
+    addAssumption(it.next());
+  }
+
+  solve(conflictCountLimit);
+
+  if (_status == UNSATISFIABLE) {
+    // explicitlyMinimizeFailedAssumptions calls solve() while iterating
+    // over _failedAssumptionBuffer, so solve() must not touch it
+    _failedAssumptionBuffer = _failedAssumptions;
+  }
+  _assumptions.reset();
+  return _status;
+}
+
+void CDCLSolver::simplify()
+{
+  CALL("CDCLSolver::simplify");
+  ASS_EQ(decisionLevel(),0);
+
+  if (_unsat) {
+    return;
+  }
+  if (propagate() != NO_CLAUSE) {
+    _unsat = true;
+    return;
+  }
+  removeSatisfied();
+}
+
+SATSolver::VarAssignment CDCLSolver::getAssignment(unsigned var)
+{
+  CALL("CDCLSolver::getAssignment");
+  ASS_EQ(_status, SATISFIABLE);
+  ASS_G(var,0); ASS_LE(var,_varCnt);
+
+  if (var >= _model.size()) {
+    // new vars have been added but the model didn't grow yet
+    return DONT_CARE;
+  }
+  return _model[var] ? TRUE : FALSE;
+}
+
+bool CDCLSolver::isZeroImplied(unsigned var)
+{
+  CALL("CDCLSolver::isZeroImplied");
+  ASS_G(var,0); ASS_LE(var,_varCnt);
+
+  // between calls to solve only the zero implied literals are assigned
+  return _value[2*var] != VAL_UNDEF;
+}
+
+void CDCLSolver::collectZeroImplied(SATLiteralStack& acc)
+{
+  CALL("CDCLSolver::collectZeroImplied");
+  ASS_EQ(decisionLevel(),0);
+
+  Stack<Lit>::Iterator it(_trail);
+  while (it.hasNext()) {
+    acc.push(toSATLiteral(it.next()));
+  }
+}
+
+SATClause* CDCLSolver::getZeroImpliedCertificate(unsigned)
+{
+  CALL("CDCLSolver::getZeroImpliedCertificate");
+
+  // Not used anywhere, see MinisatInterfacing::getZeroImpliedCertificate
+  return 0;
+}
+
+#if VDEBUG
+void CDCLSolver::assertModel()
+{
+  CALL("CDCLSolver::assertModel");
+
+  Stack<CRef>::Iterator cit(_clauses);
+  while (cit.hasNext()) {
+    CRef c = cit.next();
+    if (clHas(c,DELETED)) {
+      continue;
+    }
+    bool sat = false;
+    for (unsigned k = 0; k < clSize(c) && !sat; k++) {
+      Lit l = clLits(c)[k];
+      sat = _model[litVar(l)] == !(l&1);
+    }
+    ASS_REP(sat, c);
+  }
+}
+#endif
+
+} // namespace SAT
@@ -0,0 +1,236 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file CDCLSolver.hpp
+ * Defines class CDCLSolver
+ */
+#ifndef __CDCLSolver__
+#define __CDCLSolver__
+
+#include "Lib/DArray.hpp"
+#include "Lib/Stack.hpp"
+
+#include "SATSolver.hpp"
+#include "SATLiteral.hpp"
+#include "SATClause.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+/**
+ * In-tree conflict driven clause learning solver.
+ *
+ * Apart from the usual two watched literals, VSIDS, phase saving
+ * and learnt clause minimization the solver
+ * - restarts when the glue (LBD) of recently learnt clauses gets worse
+ *   than the long term average,
+ * - backtracks chronologically (by one level) when a non-chronological
+ *   backjump would undo too many levels,
+ * - keeps learnt clauses in three tiers by glue and vivifies the
+ *   low glue ones whenever the learnt clause database is reduced.
+ */
+class CDCLSolver : public PrimitiveProofRecordingSATSolver
+{
+public:
+  CLASS_NAME(CDCLSolver);
+  USE_ALLOCATOR(CDCLSolver);
+
+  CDCLSolver(const Shell::Options& opts, bool generateProofs=false);
+
+  /**
+   * Can be called only when all assumptions are retracted
+   */
+  virtual void addClause(SATClause* cl) override;
+
+  /**
+   * Removes clauses satisfied by the zero-implied literals.
+   */
+  virtual void simplify() override;
+
+  virtual Status solve(unsigned conflictCountLimit) override;
+
+  virtual VarAssignment getAssignment(unsigned var) override;
+  virtual bool isZeroImplied(unsigned var) override;
+  virtual void collectZeroImplied(SATLiteralStack& acc) override;
+  virtual SATClause* getZeroImpliedCertificate(unsigned var) override;
+
+  virtual void ensureVarCount(unsigned newVarCnt) override;
+  virtual unsigned newVar() override;
+
+  virtual void suggestPolarity(unsigned var, unsigned pol) override {
+    ASS_G(var,0); ASS_LE(var,_varCnt);
+    _phase[var] = pol;
+  }
+
+  virtual void addAssumption(SATLiteral lit) override;
+
+  virtual void retractAllAssumptions() override {
+    _assumptions.reset();
+    _status = UNKNOWN;
+  }
+
+  virtual bool hasAssumptions() const override {
+    return _assumptions.isNonEmpty();
+  }
+
+  Status solveUnderAssumptions(const SATLiteralStack& assumps, unsigned conflictCountLimit, bool) override;
+
+private:
+  /** Literal of variable v is 2*v if positive and 2*v+1 if negative */
+  typedef unsigned Lit;
+  /** Position of a clause in _arena */
+  typedef unsigned CRef;
+
+  static const Lit NO_LIT = UINT_MAX;
+  static const CRef NO_CLAUSE = UINT_MAX;
+
+  /** Values of literals in _value */
+  enum : signed char { VAL_FALSE = -1, VAL_UNDEF = 0, VAL_TRUE = 1 };
+
+  static Lit toLit(SATLiteral l) { return 2*l.var() + (l.isNegative() ? 1 : 0); }
+  static SATLiteral toSATLiteral(Lit l) { return SATLiteral(l>>1, (l&1) ? 0 : 1); }
+  static Lit negLit(Lit l) { return l^1; }
+  static unsigned litVar(Lit l) { return l>>1; }
+
+  struct Watch
+  {
+    Watch() {}
+    Watch(CRef c, Lit b) : cref(c), blocker(b) {}
+
+    CRef cref;
+    /** another literal of the clause; when it is true, the clause need not be visited */
+    Lit blocker;
+  };
+
+  /*
+   * A clause in _arena consists of two header words followed by its literals.
+   * The first word is the number of literals, the second one holds the flags
+   * below in the low bits and the glue of a learnt clause in the rest.
+   */
+  static const unsigned HEADER = 2;
+  static const unsigned LEARNT = 1;
+  static const unsigned DELETED = 2;
+  static const unsigned USED = 4;
+  static const unsigned VIVIFIED = 8;
+  static const unsigned GLUE_SHIFT = 4;
+
+  unsigned clSize(CRef c) const { return _arena[c]; }
+  Lit* clLits(CRef c) const { return _arena.begin()+c+HEADER; }
+  bool clHas(CRef c, unsigned flag) const { return _arena[c+1] & flag; }
+  void clSet(CRef c, unsigned flag) { _arena[c+1] |= flag; }
+  void clClear(CRef c, unsigned flag) { _arena[c+1] &= ~flag; }
+  unsigned clGlue(CRef c) const { return _arena[c+1] >> GLUE_SHIFT; }
+  void clSetGlue(CRef c, unsigned glue) {
+    _arena[c+1] = (_arena[c+1] & ((1u<<GLUE_SHIFT)-1)) | (glue << GLUE_SHIFT);
+  }
+
+  CRef allocClause(const Stack<Lit>& lits, bool learnt, unsigned glue);
+  void attachClause(CRef c);
+  void deleteClause(CRef c);
+  bool isLocked(CRef c) const;
+  void collectGarbage();
+
+  unsigned decisionLevel() const { return _trailLim.size(); }
+  void newDecisionLevel() { _trailLim.push(_trail.size()); }
+  void enqueue(Lit l, unsigned level, CRef reason);
+  void backtrack(unsigned level);
+
+  CRef propagate();
+  unsigned prepareConflict(CRef confl, bool& singleTop);
+  void analyze(CRef confl, unsigned conflLevel, unsigned& btLevel, unsigned& glue);
+  bool litRedundant(Lit p, unsigned abstractLevels);
+  unsigned computeGlue(const Lit* lits, unsigned size);
+  void analyzeFinal(Lit falseAssumption);
+
+  Status search(unsigned conflictCountLimit);
+  Lit pickBranchLit();
+  bool shouldRestart();
+  void removeSatisfied();
+  void reduceLearnts();
+  void vivifyLearnts();
+
+  void bumpVar(unsigned v);
+  void decayActivities() { _varInc *= 1/0.95; }
+  bool heapLess(unsigned v1, unsigned v2) const { return _activity[v1] > _activity[v2]; }
+  void heapInsert(unsigned v);
+  void heapUp(unsigned pos);
+  void heapDown(unsigned pos);
+  unsigned heapPop();
+
+#if VDEBUG
+  void assertModel();
+#endif
+
+  Status _status;
+  /** true if the clauses added so far are unsatisfiable on their own */
+  bool _unsat;
+  unsigned _varCnt;
+
+  Stack<unsigned> _arena;
+  /** number of words in _arena taken by deleted clauses */
+  size_t _wasted;
+  Stack<CRef> _clauses;
+  Stack<CRef> _learnts;
+
+  /** indexed by literals */
+  DArray<signed char> _value;
+  /** indexed by literals, clauses watching the literal */
+  DArray<Stack<Watch> > _watches;
+
+  /** indexed by variables */
+  DArray<unsigned> _level;
+  DArray<CRef> _reason;
+  DArray<unsigned> _phase;
+  DArray<double> _activity;
+  DArray<char> _seen;
+  /** position of the variable in _heap, or -1 */
+  DArray<int> _heapIndex;
+  DArray<char> _model;
+
+  Stack<Lit> _trail;
+  Stack<unsigned> _trailLim;
+  size_t _qhead;
+
+  Stack<Lit> _assumptions;
+  /** assumptions responsible for the last UNSATISFIABLE answer, see analyzeFinal() */
+  SATLiteralStack _failedAssumptions;
+
+  /** variables not assigned (and maybe some assigned ones), ordered by activity */
+  Stack<unsigned> _heap;
+  double _varInc;
+
+  size_t _conflicts;
+  size_t _propagations;
+  size_t _conflictsAtRestart;
+  size_t _nextReduce;
+  unsigned _reductions;
+  size_t _vivifiedAtPropagations;
+  /** trail size at level 0 when satisfied clauses were last removed */
+  size_t _simplifiedTrail;
+
+  /** moving averages of the glue of learnt clauses */
+  double _glueFast;
+  double _glueSlow;
+
+  /** per-level stamps used to compute glue */
+  DArray<size_t> _levelStamp;
+  size_t _stamp;
+
+  // auxiliary
+  Stack<Lit> _learnt;
+  Stack<Lit> _toClear;
+  Stack<Lit> _redundantStack;
+  Stack<Lit> _keptOnTrail;
+};
+
+}//end SAT namespace
+
+#endif /*__CDCLSolver__*/
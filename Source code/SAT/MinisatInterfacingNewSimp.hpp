@@ -54,6 +54,15 @@ public:
     _solver.simplify();
   }
 
+  /**
+   * Switch off variable elimination, which must be done if clauses
+   * are going to be added after solving.
+   */
+  void disableSimplification() {
+    CALL("MinisatInterfacingNewSimp::disableSimplification");
+    _solver.eliminate(true);
+  }
+
   virtual Status solve(unsigned conflictCountLimit) override;
   
   /**
@@ -869,14 +869,23 @@ struct ToZ3Expr
     if(trm->arity()==0) {
       if(symb->integerConstant()){
         IntegerConstantType value = symb->integerValue();
+        if (!value.fitsInner()) {
+          return self._context.int_val(value.toString().c_str());
+        }
         return self._context.int_val(value.toInner());
       }
       if(symb->realConstant()) {
         RealConstantType value = symb->realValue();
+        if (!value.numerator().fitsInner() || !value.denominator().fitsInner()) {
+          return self._context.real_val(value.toString().c_str());
+        }
         return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
       }
       if(symb->rationalConstant()) {
         RationalConstantType value = symb->rationalValue();
+        if (!value.numerator().fitsInner() || !value.denominator().fitsInner()) {
+          return self._context.real_val(value.toString().c_str());
+        }
         return self._context.real_val(value.numerator().toInner(),value.denominator().toInner());
       }
       if(!isLit && env.signature->isFoolConstantSymbol(true,trm->functor())) {
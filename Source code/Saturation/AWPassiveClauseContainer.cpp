@@ -43,6 +43,7 @@ using namespace Kernel;
 
 AWPassiveClauseContainer::AWPassiveClauseContainer(bool isOutermost, const Shell::Options& opt, vstring name) :
   PassiveClauseContainer(isOutermost, opt, name),
+  _buckets(0),
   _ageQueue(opt),
   _weightQueue(opt),
   _ageRatio(opt.ageRatio()),
@@ -51,8 +52,8 @@ AWPassiveClauseContainer::AWPassiveClauseContainer(bool isOutermost, const Shell
   _size(0),
 
   _simulationBalance(0),
-  _simulationCurrAgeIt(_ageQueue),
-  _simulationCurrWeightIt(_weightQueue),
+  _simulationCurrAgeIt(ClauseIterator::getEmpty()),
+  _simulationCurrWeightIt(ClauseIterator::getEmpty()),
   _simulationCurrAgeCl(nullptr),
   _simulationCurrWeightCl(nullptr),
 
@@ -70,17 +71,50 @@ AWPassiveClauseContainer::AWPassiveClauseContainer(bool isOutermost, const Shell
   ASS_GE(_ageRatio, 0);
   ASS_GE(_weightRatio, 0);
   ASS(_ageRatio > 0 || _weightRatio > 0);
+
+  // the buckets order the clauses by age and weight only, so the skip-list
+  // queues are kept for the weight order that puts reductions first
+  if (!env.options->prioritiseClausesProducedByLongReduction()) {
+    _buckets = new ClauseBucketQueue(opt);
+  }
 }
 
 AWPassiveClauseContainer::~AWPassiveClauseContainer()
 {
-  ClauseQueue::Iterator cit(_ageQueue);
+  ClauseIterator cit = ageOrder();
   while (cit.hasNext()) 
   {
     Clause* cl=cit.next();
     ASS(!_isOutermost || cl->store()==Clause::PASSIVE);
     cl->setStore(Clause::NONE);
   }
+  if (_buckets) {
+    delete _buckets;
+  }
+}
+
+/**
+ * Return iterator over the clauses in the age order. Without
+ * the buckets it is empty if _ageRatio=0.
+ */
+ClauseIterator AWPassiveClauseContainer::ageOrder()
+{
+  if (_buckets) {
+    return pvi( ClauseBucketQueue::AgeIterator(*_buckets) );
+  }
+  return pvi( ClauseQueue::Iterator(_ageQueue) );
+}
+
+/**
+ * Return iterator over the clauses in the weight order. Without
+ * the buckets it is empty if _weightRatio=0.
+ */
+ClauseIterator AWPassiveClauseContainer::weightOrder()
+{
+  if (_buckets) {
+    return pvi( ClauseBucketQueue::WeightIterator(*_buckets) );
+  }
+  return pvi( ClauseQueue::Iterator(_weightQueue) );
 }
 
 
@@ -189,11 +223,16 @@ void AWPassiveClauseContainer::add(Clause* cl)
   ASS(_ageRatio > 0 || _weightRatio > 0);
   ASS(cl->store() == Clause::PASSIVE);
 
-  if (_ageRatio) {
-    _ageQueue.insert(cl);
+  if (_buckets) {
+    _buckets->insert(cl);
   }
-  if (_weightRatio) {
-    _weightQueue.insert(cl);
+  else {
+    if (_ageRatio) {
+      _ageQueue.insert(cl);
+    }
+    if (_weightRatio) {
+      _weightQueue.insert(cl);
+    }
   }
   _size++;
 
@@ -218,11 +257,16 @@ void AWPassiveClauseContainer::remove(Clause* cl)
   }
   ASS(_ageRatio > 0 || _weightRatio > 0);
   bool wasRemoved; // will be assigned, since at least one of the following checks succeeds
-  if (_ageRatio) {
-    wasRemoved = _ageQueue.remove(cl);
+  if (_buckets) {
+    wasRemoved = _buckets->remove(cl);
   }
-  if (_weightRatio) {
-    wasRemoved = _weightQueue.remove(cl);
+  else {
+    if (_ageRatio) {
+      wasRemoved = _ageQueue.remove(cl);
+    }
+    if (_weightRatio) {
+      wasRemoved = _weightQueue.remove(cl);
+    }
   }
 
   if (wasRemoved) {
@@ -297,12 +341,22 @@ Clause* AWPassiveClauseContainer::popSelected()
   Clause* cl;
   if (byWeight(_balance)) {
     _balance -= _ageRatio;
-    cl = _weightQueue.pop();
-    _ageQueue.remove(cl);
+    if (_buckets) {
+      cl = _buckets->popByWeight();
+    }
+    else {
+      cl = _weightQueue.pop();
+      _ageQueue.remove(cl);
+    }
   } else {
     _balance += _weightRatio;
-    cl = _ageQueue.pop();
-    _weightQueue.remove(cl);
+    if (_buckets) {
+      cl = _buckets->popByAge();
+    }
+    else {
+      cl = _ageQueue.pop();
+      _weightQueue.remove(cl);
+    }
   }
 
   if (_isOutermost) {
@@ -327,7 +381,7 @@ void AWPassiveClauseContainer::onLimitsUpdated()
   //(unless one of _ageRation or _weightRatio is equal to 0)
 
   static Stack<Clause*> toRemove(256);
-  ClauseQueue::Iterator wit(_weightQueue);
+  ClauseIterator wit = weightOrder();
   while (wit.hasNext()) {
     Clause* cl=wit.next();
     if (!fulfilsAgeLimit(cl) && !fulfilsWeightLimit(cl)) {
@@ -359,12 +413,12 @@ void AWPassiveClauseContainer::simulationInit()
   // initialize iterators
   if (_ageRatio > 0)
   {
-    _simulationCurrAgeIt = ClauseQueue::Iterator(_ageQueue);
+    _simulationCurrAgeIt = ageOrder();
     _simulationCurrAgeCl = _simulationCurrAgeIt.hasNext() ? _simulationCurrAgeIt.next() : nullptr;
   }
   if (_weightRatio > 0)
   {
-    _simulationCurrWeightIt = ClauseQueue::Iterator(_weightQueue);
+    _simulationCurrWeightIt = weightOrder();
     _simulationCurrWeightCl = _simulationCurrWeightIt.hasNext() ? _simulationCurrWeightIt.next() : nullptr;
   }
 
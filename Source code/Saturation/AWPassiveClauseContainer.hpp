@@ -20,6 +20,7 @@
 #include <vector>
 #include "Lib/Comparison.hpp"
 #include "Kernel/Clause.hpp"
+#include "Kernel/ClauseBucketQueue.hpp"
 #include "Kernel/ClauseQueue.hpp"
 #include "ClauseContainer.hpp"
 
@@ -79,16 +80,22 @@ public:
   Clause* popSelected() override;
   /** True if there are no passive clauses */
   bool isEmpty() const override
-  { return _ageQueue.isEmpty() && _weightQueue.isEmpty(); }
+  { return _buckets ? _buckets->isEmpty() : (_ageQueue.isEmpty() && _weightQueue.isEmpty()); }
 
   unsigned sizeEstimate() const override { return _size; }
 
   static Comparison compareWeight(Clause* cl1, Clause* cl2, const Shell::Options& opt);
 
 private:
-  /** The age queue, empty if _ageRatio=0 */
+  ClauseIterator ageOrder();
+  ClauseIterator weightOrder();
+
+  /** The clauses in both the age and the weight order, zero if the
+   * queues below are used instead (see the constructor) */
+  ClauseBucketQueue* _buckets;
+  /** The age queue, empty if _ageRatio=0 or _buckets is used */
   AgeQueue _ageQueue;
-  /** The weight queue, empty if _weightRatio=0 */
+  /** The weight queue, empty if _weightRatio=0 or _buckets is used */
   WeightQueue _weightQueue;
   /** the age ratio */
   int _ageRatio;
@@ -118,8 +125,8 @@ private:
   bool setLimits(unsigned newAgeSelectionMaxAge, unsigned newAgeSelectionMaxWeight, unsigned newWeightSelectionMaxWeight, unsigned newWeightSelectionMaxAge);
 
   int _simulationBalance;
-  ClauseQueue::Iterator _simulationCurrAgeIt;
-  ClauseQueue::Iterator _simulationCurrWeightIt;
+  ClauseIterator _simulationCurrAgeIt;
+  ClauseIterator _simulationCurrWeightIt;
   Clause* _simulationCurrAgeCl;
   Clause* _simulationCurrWeightCl;
 
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file Checkpoint.cpp
+ * Implements class Checkpoint.
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "Lib/Environment.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/Sort.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+
+#include "Shell/Statistics.hpp"
+#include "Shell/TPTPPrinter.hpp"
+
+#include "ClauseContainer.hpp"
+#include "SaturationAlgorithm.hpp"
+
+#include "Checkpoint.hpp"
+
+#define CHECKPOINT_HEADER "% vampire checkpoint 1"
+#define CHECKPOINT_INCOMPLETE "% incomplete 1"
+
+namespace Saturation
+{
+
+using namespace Shell;
+
+/**
+ * Start checkpointing clauses of @b sa into @b fileName every @b interval seconds
+ */
+Checkpoint::Checkpoint(SaturationAlgorithm& sa, const vstring& fileName, unsigned interval)
+: _sa(sa), _fileName(fileName), _interval(interval*1000)
+{
+  CALL("Checkpoint::Checkpoint");
+  ASS_G(interval,0);
+
+  _nextTime = env.timer->elapsedMilliseconds() + _interval;
+
+  ClauseContainer* active = sa.getGeneratingClauseContainer();
+  PassiveClauseContainer* passive = sa.getPassiveClauseContainer();
+  _sdActiveAdded = active->addedEvent.subscribe(this,&Checkpoint::onClauseAdded);
+  _sdActiveRemoved = active->removedEvent.subscribe(this,&Checkpoint::onClauseRemoved);
+  _sdPassiveAdded = passive->addedEvent.subscribe(this,&Checkpoint::onClauseAdded);
+  _sdPassiveRemoved = passive->removedEvent.subscribe(this,&Checkpoint::onClauseRemoved);
+  _sdPassiveSelected = passive->selectedEvent.subscribe(this,&Checkpoint::onClauseRemoved);
+}
+
+Checkpoint::~Checkpoint()
+{
+  CALL("Checkpoint::~Checkpoint");
+
+  _sdActiveAdded->unsubscribe();
+  _sdActiveRemoved->unsubscribe();
+  _sdPassiveAdded->unsubscribe();
+  _sdPassiveRemoved->unsubscribe();
+  _sdPassiveSelected->unsubscribe();
+}
+
+void Checkpoint::onClauseAdded(Clause* cl)
+{
+  _clauses.insert(cl);
+}
+
+void Checkpoint::onClauseRemoved(Clause* cl)
+{
+  _clauses.remove(cl);
+}
+
+struct ClauseNumberComparator
+{
+  static Comparison compare(Clause* c1, Clause* c2)
+  { return Int::compare(c1->number(), c2->number()); }
+};
+
+/**
+ * Write the current clauses into the checkpoint file
+ *
+ * The clauses are first written into a temporary file which then replaces
+ * the checkpoint file, so that a run killed while writing leaves the
+ * previous checkpoint intact.
+ */
+void Checkpoint::write()
+{
+  CALL("Checkpoint::write");
+
+  _nextTime = env.timer->elapsedMilliseconds() + _interval;
+
+  // clauses split by AVATAR and those discarded by LRS are lost, as well
+  // as anything the strategy itself does not need for completeness
+  bool incomplete = !_sa.isComplete() || env.statistics->splitClauses ||
+                    env.statistics->discardedNonRedundantClauses;
+
+  Stack<Clause*> clauses;
+  DHSet<Clause*>::Iterator cit(_clauses);
+  while(cit.hasNext()) {
+    Clause* cl = cit.next();
+    if(cl->noSplits()) {
+      clauses.push(cl);
+    }
+    else {
+      incomplete = true;
+    }
+  }
+  sort<ClauseNumberComparator>(clauses.begin(), clauses.end());
+
+  vstring tmpName = _fileName + ".tmp";
+  {
+    BYPASSING_ALLOCATOR;
+
+    ofstream out(tmpName.c_str());
+    if(out.fail()) {
+      env.beginOutput();
+      env.out() << "% Cannot write checkpoint file " << tmpName << endl;
+      env.endOutput();
+      return;
+    }
+    out << CHECKPOINT_HEADER << endl;
+    out << "% incomplete " << incomplete << endl;
+    TPTPPrinter printer(&out);
+    Stack<Clause*>::BottomFirstIterator it(clauses);
+    while(it.hasNext()) {
+      Clause* cl = it.next();
+      printer.printWithRole("c" + Int::toString(cl->number()), "axiom", cl, false);
+    }
+    out.close();
+    if(out.fail() || rename(tmpName.c_str(), _fileName.c_str())) {
+      env.beginOutput();
+      env.out() << "% Cannot write checkpoint file " << _fileName << endl;
+      env.endOutput();
+      return;
+    }
+  }
+  env.statistics->checkpoints++;
+}
+
+/**
+ * True if @b fileName is a checkpoint that lacks some clauses of the run
+ * that wrote it, so saturating it does not mean the problem is satisfiable
+ */
+bool Checkpoint::isIncomplete(const vstring& fileName)
+{
+  CALL("Checkpoint::isIncomplete");
+
+  BYPASSING_ALLOCATOR;
+
+  ifstream in(fileName.c_str());
+  vstring header, incomplete;
+  return getline(in, header) && header == CHECKPOINT_HEADER &&
+         getline(in, incomplete) && incomplete == CHECKPOINT_INCOMPLETE;
+}
+
+}
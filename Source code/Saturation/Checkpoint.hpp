@@ -0,0 +1,89 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file Checkpoint.hpp
+ * Defines class Checkpoint.
+ */
+
+#ifndef __Checkpoint__
+#define __Checkpoint__
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Event.hpp"
+#include "Lib/Timer.hpp"
+
+namespace Saturation {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Periodic checkpoints of the active and passive clauses of a saturation
+ * algorithm (see the checkpoint_file option).
+ *
+ * A checkpoint is a TPTP file with the clauses and the declarations of
+ * the symbols they use, so a killed run can be restarted by giving the
+ * file as input to a new one. Clauses depending on AVATAR assumptions
+ * are left out, as they only hold under the assumptions.
+ *
+ * The clauses written may not be equisatisfiable with the input problem,
+ * e.g. because AVATAR split clauses or LRS discarded some. Such a
+ * checkpoint is marked as incomplete in its header and a run restarted
+ * from it treats the problem as the result of an incomplete
+ * transformation, so it cannot report satisfiability.
+ */
+class Checkpoint
+{
+public:
+  CLASS_NAME(Checkpoint);
+  USE_ALLOCATOR(Checkpoint);
+
+  Checkpoint(SaturationAlgorithm& sa, const vstring& fileName, unsigned interval);
+  ~Checkpoint();
+
+  /** To be called after each step of the saturation algorithm */
+  void onStep()
+  {
+    if(env.timer->elapsedMilliseconds() >= _nextTime) {
+      write();
+    }
+  }
+  void write();
+
+  static bool isIncomplete(const vstring& fileName);
+
+private:
+  void onClauseAdded(Clause* cl);
+  void onClauseRemoved(Clause* cl);
+
+  SaturationAlgorithm& _sa;
+  vstring _fileName;
+  /** interval between two checkpoints in milliseconds */
+  int _interval;
+  /** time of the next checkpoint in milliseconds */
+  int _nextTime;
+
+  /** the active and passive clauses */
+  DHSet<Clause*> _clauses;
+
+  SubscriptionData _sdActiveAdded;
+  SubscriptionData _sdActiveRemoved;
+  SubscriptionData _sdPassiveAdded;
+  SubscriptionData _sdPassiveRemoved;
+  SubscriptionData _sdPassiveSelected;
+};
+
+}
+
+#endif // __Checkpoint__
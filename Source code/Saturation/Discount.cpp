@@ -37,6 +37,10 @@ bool Discount::handleClauseBeforeActivation(Clause* cl)
   CALL("Discount::handleClauseBeforeActivation");
   ASS(cl->store()==Clause::SELECTED);
 
+  if (cl->hasDeferredLiterals() && !materializeDeferred(cl)) {
+    cl->setStore(Clause::NONE);
+    return false;
+  }
   if (!forwardSimplify(cl)) {
     cl->setStore(Clause::NONE);
     return false;
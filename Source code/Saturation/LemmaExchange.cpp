@@ -0,0 +1,255 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file LemmaExchange.cpp
+ * Implements class LemmaExchange.
+ */
+
+#include "Lib/Environment.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/SortHelper.hpp"
+
+#include "Shell/Property.hpp"
+#include "Shell/Statistics.hpp"
+
+#include "LemmaExchange.hpp"
+
+#define LEMMA_EXCHANGE_SLOTS 4096
+#define LEMMA_EXCHANGE_SLOT_SIZE 64
+
+namespace Saturation
+{
+
+using namespace Shell;
+
+LemmaExchange* LemmaExchange::s_instance = 0;
+
+/**
+ * Create the exchange. To be called in the portfolio process before
+ * the slices are forked.
+ *
+ * Nothing is created for higher-order and polymorphic problems, as their
+ * terms carry types which are not exchanged.
+ */
+void LemmaExchange::init()
+{
+  CALL("LemmaExchange::init");
+  ASS(!s_instance);
+
+  if(env.property->higherOrder() || env.property->hasPolymorphicSym()) {
+    return;
+  }
+  s_instance = new LemmaExchange();
+}
+
+LemmaExchange::LemmaExchange()
+: _buffer(LEMMA_EXCHANGE_SLOTS, LEMMA_EXCHANGE_SLOT_SIZE),
+  _functions(env.signature->functions()),
+  _predicates(env.signature->predicates()),
+  _typeCons(env.signature->typeCons()),
+  _position(0)
+{
+}
+
+/**
+ * Publish @b cl for the other slices. Return false if the clause cannot
+ * be exchanged, i.e. it is too big or contains symbols introduced after
+ * the exchange was created.
+ *
+ * The clause is encoded as the number of its literals followed by its
+ * literals. A literal is encoded as its predicate number shifted left by
+ * one with the polarity in the lowest bit, followed by the sort of the
+ * arguments for an equality, and by its arguments. A term is encoded as
+ * its functor shifted left by one and followed by its arguments, a variable
+ * as its number shifted left by one with the lowest bit set.
+ */
+bool LemmaExchange::exportClause(Clause* cl)
+{
+  CALL("LemmaExchange::exportClause");
+
+  _record.reset();
+  _record.push(cl->length());
+  for(unsigned i=0;i<cl->length();i++) {
+    Literal* lit = (*cl)[i];
+    if(lit->functor() >= _predicates) {
+      return false;
+    }
+    _record.push((lit->functor() << 1) | lit->polarity());
+    if(lit->isEquality() && !encodeSort(SortHelper::getEqualityArgumentSort(lit))) {
+      return false;
+    }
+    for(TermList* arg = lit->args(); arg->isNonEmpty(); arg = arg->next()) {
+      if(!encode(*arg)) {
+        return false;
+      }
+    }
+  }
+
+  if(!_buffer.publish(_record.begin(), _record.size())) {
+    return false;
+  }
+  env.statistics->exportedLemmas++;
+  return true;
+}
+
+bool LemmaExchange::encode(TermList t)
+{
+  CALL("LemmaExchange::encode");
+
+  if(_record.size() > _buffer.slotSize()) {
+    return false;
+  }
+  if(t.isVar()) {
+    _record.push((t.var() << 1) | 1);
+    return true;
+  }
+  Term* trm = t.term();
+  if(trm->isSpecial() || trm->functor() >= _functions) {
+    return false;
+  }
+  _record.push(trm->functor() << 1);
+  for(TermList* arg = trm->args(); arg->isNonEmpty(); arg = arg->next()) {
+    if(!encode(*arg)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LemmaExchange::encodeSort(TermList s)
+{
+  CALL("LemmaExchange::encodeSort");
+
+  if(s.isVar() || s.term()->functor() >= _typeCons || _record.size() > _buffer.slotSize()) {
+    return false;
+  }
+  _record.push(s.term()->functor() << 1);
+  for(TermList* arg = s.term()->args(); arg->isNonEmpty(); arg = arg->next()) {
+    if(!encodeSort(*arg)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Return the next clause published by another slice, or 0 if there is none
+ */
+Clause* LemmaExchange::importClause()
+{
+  CALL("LemmaExchange::importClause");
+
+  static Stack<Literal*> lits;
+  static Stack<TermList> args;
+
+next_record:
+  if(!_buffer.read(_position, _record)) {
+    return 0;
+  }
+  _recordIndex = 0;
+  lits.reset();
+
+  if(_record.isEmpty()) {
+    goto next_record;
+  }
+  unsigned length = _record[_recordIndex++];
+  for(unsigned i=0;i<length;i++) {
+    if(_recordIndex == _record.size()) {
+      goto next_record;
+    }
+    unsigned header = _record[_recordIndex++];
+    unsigned pred = header >> 1;
+    bool polarity = header & 1;
+    if(pred >= _predicates) {
+      goto next_record;
+    }
+    if(pred == 0) {
+      TermList sort, lhs, rhs;
+      if(!decodeSort(sort) || !decode(lhs) || !decode(rhs)) {
+        goto next_record;
+      }
+      lits.push(Literal::createEquality(polarity, lhs, rhs, sort));
+      continue;
+    }
+    unsigned arity = env.signature->predicateArity(pred);
+    args.reset();
+    for(unsigned j=0;j<arity;j++) {
+      TermList arg;
+      if(!decode(arg)) {
+        goto next_record;
+      }
+      args.push(arg);
+    }
+    lits.push(Literal::create(pred, arity, polarity, false, args.begin()));
+  }
+
+  Clause* res = Clause::fromStack(lits, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::IMPORTED_LEMMA));
+  env.statistics->importedLemmas++;
+  return res;
+}
+
+bool LemmaExchange::decode(TermList& res)
+{
+  CALL("LemmaExchange::decode");
+
+  if(_recordIndex == _record.size()) {
+    return false;
+  }
+  unsigned word = _record[_recordIndex++];
+  if(word & 1) {
+    res = TermList(word >> 1, false);
+    return true;
+  }
+  unsigned functor = word >> 1;
+  if(functor >= _functions) {
+    return false;
+  }
+  unsigned arity = env.signature->functionArity(functor);
+  Stack<TermList> args(arity);
+  for(unsigned i=0;i<arity;i++) {
+    TermList arg;
+    if(!decode(arg)) {
+      return false;
+    }
+    args.push(arg);
+  }
+  res = TermList(Term::create(functor, arity, args.begin()));
+  return true;
+}
+
+bool LemmaExchange::decodeSort(TermList& res)
+{
+  CALL("LemmaExchange::decodeSort");
+
+  if(_recordIndex == _record.size()) {
+    return false;
+  }
+  unsigned word = _record[_recordIndex++];
+  unsigned typeCon = word >> 1;
+  if((word & 1) || typeCon >= _typeCons) {
+    return false;
+  }
+  unsigned arity = env.signature->typeConArity(typeCon);
+  Stack<TermList> args(arity);
+  for(unsigned i=0;i<arity;i++) {
+    TermList arg;
+    if(!decodeSort(arg)) {
+      return false;
+    }
+    args.push(arg);
+  }
+  res = TermList(AtomicSort::create(typeCon, arity, args.begin()));
+  return true;
+}
+
+}
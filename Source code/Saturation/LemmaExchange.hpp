@@ -0,0 +1,83 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file LemmaExchange.hpp
+ * Defines class LemmaExchange.
+ */
+
+#ifndef __LemmaExchange__
+#define __LemmaExchange__
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Stack.hpp"
+#include "Lib/Sys/SharedRingBuffer.hpp"
+
+#include "Kernel/Term.hpp"
+
+namespace Saturation {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Exchange of derived unit clauses between the slices of a portfolio run
+ * (see the lemma_exchange option).
+ *
+ * The exchange is created by the portfolio process before the slices are
+ * forked and records how many symbols the signature had at that time.
+ * Only clauses built of these symbols are exchanged, as they mean the same
+ * in all slices, whereas the symbols introduced later (e.g. by Skolemisation
+ * or naming) may differ from slice to slice. Since the preprocessing of all
+ * slices only produces conservative extensions of the common input problem,
+ * a clause over the common symbols that is derived without AVATAR
+ * assumptions in one slice is a consequence of the problem in all of them.
+ */
+class LemmaExchange
+{
+public:
+  CLASS_NAME(LemmaExchange);
+  USE_ALLOCATOR(LemmaExchange);
+
+  static void init();
+  /** Return the exchange of the current portfolio run, or 0 if there is none */
+  static LemmaExchange* instance() { return s_instance; }
+
+  bool exportClause(Clause* cl);
+  Clause* importClause();
+
+private:
+  LemmaExchange();
+
+  bool encode(TermList t);
+  bool encodeSort(TermList s);
+  bool decode(TermList& res);
+  bool decodeSort(TermList& res);
+
+  Lib::Sys::SharedRingBuffer _buffer;
+
+  /** numbers of symbols present in the signature when the exchange was created */
+  unsigned _functions;
+  unsigned _predicates;
+  unsigned _typeCons;
+
+  /** position of the next record to be read from the buffer */
+  unsigned long _position;
+
+  Stack<unsigned> _record;
+  unsigned _recordIndex;
+
+  static LemmaExchange* s_instance;
+};
+
+}
+
+#endif // __LemmaExchange__
@@ -117,6 +117,42 @@ void ProvingHelper::runVampire(Problem& prb, const Options& opt)
   }
 }
 
+/**
+ * Run only the Vampire preprocessing (based on the content of @b opt )
+ * on @b prb, so that @b runVampireSaturation can be called on it later.
+ *
+ * Return false if a resource limit was hit during preprocessing, in which
+ * case the reason is recorded in @b env.statistics
+ */
+bool ProvingHelper::runVampirePreprocessing(Problem& prb, const Options& opt)
+{
+  CALL("ProvingHelper::runVampirePreprocessing");
+
+  try {
+    TimeCounter tc2(TC_PREPROCESSING);
+
+    Preprocess prepro(opt);
+    prepro.preprocess(prb);
+    return true;
+  }
+  catch(MemoryLimitExceededException&) {
+    env.statistics->terminationReason=Statistics::MEMORY_LIMIT;
+    env.statistics->refutation=0;
+    size_t limit=Allocator::getMemoryLimit();
+    //add extra 1 MB to allow proper termination
+    Allocator::setMemoryLimit(limit+1000000);
+  }
+  catch(TimeLimitExceededException&) {
+    env.statistics->terminationReason=Statistics::TIME_LIMIT;
+    env.statistics->refutation=0;
+  }
+  catch(ActivationLimitExceededException&) {
+    env.statistics->terminationReason=Statistics::ACTIVATION_LIMIT;
+    env.statistics->refutation=0;
+  }
+  return false;
+}
+
 /**
  * Private version of the @b runVampireSaturation function
  * that is not protected for resource-limit exceptions
@@ -47,6 +47,7 @@
 #include "Inferences/EquationalTautologyRemoval.hpp"
 #include "Inferences/Condensation.hpp"
 #include "Inferences/FastCondensation.hpp"
+#include "Inferences/FeatureVectorBackwardSubsumption.hpp"
 #include "Inferences/DistinctEqualitySimplifier.hpp"
 
 #include "Inferences/InferenceEngine.hpp"
@@ -101,8 +102,11 @@
 
 #include "Splitter.hpp"
 
+#include "Checkpoint.hpp"
 #include "ConsequenceFinder.hpp"
 #include "LabelFinder.hpp"
+#include "LemmaExchange.hpp"
+#include "SliceProgress.hpp"
 #include "Splitter.hpp"
 #include "SymElOutput.hpp"
 #include "SaturationAlgorithm.hpp"
@@ -220,7 +224,7 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
     _clauseActivationInProgress(false),
     _fwSimplifiers(0), _simplifiers(0), _bwSimplifiers(0), _splitter(0),
     _consFinder(0), _labelFinder(0), _symEl(0), _answerLiteralManager(0),
-    _instantiation(0),
+    _instantiation(0), _lemmaExchange(0), _checkpoint(0), _sliceProgress(0),
     _generatedClauseCount(0),
     _activationLimit(0)
 {
@@ -229,6 +233,17 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
 
   _activationLimit = opt.activationLimit();
 
+  if (opt.lemmaExchange()) {
+    _lemmaExchange = LemmaExchange::instance();
+  }
+  if (opt.adaptiveSlices()) {
+    _sliceProgress = SliceProgress::instance();
+  }
+  // Otter and LRS simplify by passive clauses, so forward subsumption already catches the variants
+  if (opt.unprocessedVariantDeletion() && opt.saturationAlgorithm()==Options::SaturationAlgorithm::DISCOUNT) {
+    _unprocessedVariants = new HashingClauseVariantIndex();
+  }
+
   _ordering = OrderingSP(Ordering::create(prb, opt));
   if (!Ordering::trySetGlobalOrdering(_ordering)) {
     //this is not an error, it may just lead to lower performance (and most likely not significantly lower)
@@ -262,6 +277,10 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   _unprocessed->removedEvent.subscribe(this, &SaturationAlgorithm::onUnprocessedRemoved);
   _unprocessed->selectedEvent.subscribe(this, &SaturationAlgorithm::onUnprocessedSelected);
 
+  if (!opt.checkpointFile().empty() && opt.checkpointInterval()) {
+    _checkpoint = new Checkpoint(*this, opt.checkpointFile(), opt.checkpointInterval());
+  }
+
   if (opt.extensionalityResolution() != Options::ExtensionalityResolution::OFF) {
     _extensionality = new ExtensionalityClauseContainer(opt);
     //_active->addedEvent.subscribe(_extensionality, &ExtensionalityClauseContainer::addIfExtensionality);
@@ -285,6 +304,9 @@ SaturationAlgorithm::~SaturationAlgorithm()
   if (_splitter) {
     delete _splitter;
   }
+  if (_checkpoint) {
+    delete _checkpoint;
+  }
   if (_consFinder) {
     delete _consFinder;
   }
@@ -852,7 +874,10 @@ void SaturationAlgorithm::addNewClause(Clause* cl)
   //(there the control flow goes out of the SaturationAlgorithm class,
   //so we'd better not assume on what's happening out there)
   cl->incRefCnt();
-  onNewClause(cl);
+  if (!cl->hasDeferredLiterals()) {
+    // deferred clauses are announced in materializeDeferred
+    onNewClause(cl);
+  }
   _newClauses.push(cl);
   //we can decrease the counter here -- it won't get deleted because
   //the _newClauses RC stack already took over the clause
@@ -915,10 +940,12 @@ void SaturationAlgorithm::addUnprocessedClause(Clause* cl)
 
   env.checkTimeSometime<64>();
 
-
-  cl=doImmediateSimplification(cl);
-  if (!cl) {
-    return;
+  // clauses with deferred literals are simplified once they are selected
+  if (!cl->hasDeferredLiterals()) {
+    cl=doImmediateSimplification(cl);
+    if (!cl) {
+      return;
+    }
   }
 
   if (cl->isEmpty()) {
@@ -1133,6 +1160,24 @@ void SaturationAlgorithm::removeActiveOrPassiveClause(Clause* cl)
   //at this point the cl object can be already deleted
 }
 
+/**
+ * Build the deferred literals of the selected clause @b cl and perform
+ * what was skipped when it was added to passive. Return false if the
+ * clause turned out to be redundant.
+ */
+bool SaturationAlgorithm::materializeDeferred(Clause* cl)
+{
+  CALL("SaturationAlgorithm::materializeDeferred");
+  ASS_EQ(cl->store(), Clause::SELECTED);
+
+  env.statistics->materializedClauses++;
+  if (!cl->buildDeferredLiterals()) {
+    return false;
+  }
+  onNewClause(cl);
+  return doImmediateSimplification(cl) != 0;
+}
+
 /**
  * Add clause @b c to the passive container
  */
@@ -1196,6 +1241,12 @@ void SaturationAlgorithm::activate(Clause* cl)
   env.statistics->activeClauses++;
   _active->add(cl);
 
+  // share derived units that hold regardless of the AVATAR model
+  if (_lemmaExchange && cl->length() == 1 && cl->age() > 0 &&
+      cl->weight() <= _opt.lemmaExchange() && cl->noSplits()) {
+    _lemmaExchange->exportClause(cl);
+  }
+
     
     auto generated = _generator->generateSimplify(cl);
 
@@ -1253,10 +1304,21 @@ start:
     Clause* c = _unprocessed->pop();
     ASS(!isRefutation(c));
 
-    if (forwardSimplify(c)) {
+    if (c->hasDeferredLiterals()) {
+      addToPassive(c);
+    }
+    else if (_unprocessedVariants && isUnprocessedVariant(c)) {
+      ASS_EQ(c->store(), Clause::UNPROCESSED);
+      c->setStore(Clause::NONE);
+    }
+    else if (forwardSimplify(c)) {
       onClauseRetained(c);
       addToPassive(c);
       ASS_EQ(c->store(), Clause::PASSIVE);
+      if (_unprocessedVariants) {
+        _unprocessedVariants->insert(c);
+        _unprocessedRetained.push(c);
+      }
     }
     else {
       ASS_EQ(c->store(), Clause::UNPROCESSED);
@@ -1277,6 +1339,36 @@ start:
     goto start;
   }
 
+  if (_unprocessedVariants) {
+    // the retained clauses may get activated and simplified from now on
+    _unprocessedVariants->reset();
+    _unprocessedRetained.reset();
+  }
+}
+
+/**
+ * Return true if a variant of @b c with the same AVATAR assumptions was
+ * retained since the unprocessed queue was last emptied.
+ *
+ * Such a variant is already in passive, so @b c adds nothing to the search
+ * space. Only used with Discount, whose forward subsumption looks at active
+ * clauses only; Otter and LRS put the variant into the simplifying container
+ * as soon as it is passive. The variant may have been simplified against
+ * different clauses than @b c would be now, as the active set can change
+ * during the batch.
+ */
+bool SaturationAlgorithm::isUnprocessedVariant(Clause* c)
+{
+  CALL("SaturationAlgorithm::isUnprocessedVariant");
+
+  ClauseIterator variants = _unprocessedVariants->retrieveVariants(c);
+  while (variants.hasNext()) {
+    if (variants.next()->splits() == c->splits()) {
+      env.statistics->unprocessedVariants++;
+      return true;
+    }
+  }
+  return false;
 }
 
 /**
@@ -1290,6 +1382,19 @@ bool SaturationAlgorithm::handleClauseBeforeActivation(Clause* c)
   return true;
 }
 
+/**
+ * Add the clauses published by the other slices of the portfolio run
+ */
+void SaturationAlgorithm::importLemmas()
+{
+  CALL("SaturationAlgorithm::importLemmas");
+
+  Clause* cl;
+  while ((cl = _lemmaExchange->importClause())) {
+    addNewClause(cl);
+  }
+}
+
 /**
  * This function should be called if (and only if) we will use
  * the @c doOneAlgorithmStep() function to run the saturation
@@ -1327,6 +1432,10 @@ void SaturationAlgorithm::doOneAlgorithmStep()
 {
   CALL("SaturationAlgorithm::doOneAlgorithmStep");
 
+  if (_lemmaExchange) {
+    importLemmas();
+  }
+
   doUnprocessedLoop();
 
   if (_passive->isEmpty()) {
@@ -1384,8 +1493,17 @@ MainLoopResult SaturationAlgorithm::runImpl()
 
       Timer::syncClock();
       if (env.timeLimitReached()) {
+        if (_checkpoint) {
+          _checkpoint->write();
+        }
         throw TimeLimitExceededException();
       }
+      if (_checkpoint) {
+        _checkpoint->onStep();
+      }
+      if (_sliceProgress) {
+        _sliceProgress->onStep(*_passive);
+      }
     }
   }
   catch(ThrowableBase&)
@@ -1709,7 +1827,12 @@ SaturationAlgorithm* SaturationAlgorithm::createFromOptions(Problem& prb, const
   }
   if (opt.backwardSubsumption() != Options::Subsumption::OFF) {
     bool byUnitsOnly=opt.backwardSubsumption()==Options::Subsumption::UNIT_ONLY;
-    res->addBackwardSimplifierToFront(new SLQueryBackwardSubsumption(byUnitsOnly));
+    if (opt.backwardSubsumptionIndex() == Options::BackwardSubsumptionIndex::FEATURE_VECTOR) {
+      res->addBackwardSimplifierToFront(new FeatureVectorBackwardSubsumption(byUnitsOnly));
+    }
+    else {
+      res->addBackwardSimplifierToFront(new SLQueryBackwardSubsumption(byUnitsOnly));
+    }
   }
   if (opt.backwardSubsumptionResolution() != Options::Subsumption::OFF) {
     bool byUnitsOnly=opt.backwardSubsumptionResolution()==Options::Subsumption::UNIT_ONLY;
@@ -27,6 +27,7 @@
 #include "Kernel/MainLoop.hpp"
 #include "Kernel/RCClauseStack.hpp"
 
+#include "Indexing/ClauseVariantIndex.hpp"
 #include "Indexing/IndexManager.hpp"
 
 #include "Inferences/InferenceEngine.hpp"
@@ -122,6 +123,9 @@ public:
 
   Splitter* getSplitter() { return _splitter; }
 
+  /** True if saturating the clauses means the problem is satisfiable */
+  virtual bool isComplete();
+
 protected:
   virtual void init();
   virtual MainLoopResult runImpl();
@@ -132,8 +136,10 @@ protected:
   void newClausesToUnprocessed();
   void addUnprocessedClause(Clause* cl);
   bool forwardSimplify(Clause* c);
+  bool isUnprocessedVariant(Clause* c);
   void backwardSimplify(Clause* c);
   void addToPassive(Clause* c);
+  bool materializeDeferred(Clause* c);
   void activate(Clause* c);
   void removeSelected(Clause*);
   virtual void onSOSClauseAdded(Clause* c) {}
@@ -151,7 +157,6 @@ protected:
   virtual void beforeSelectedRemoved(Clause* cl) {};
   void onAllProcessed();
   int elapsedTime();
-  virtual bool isComplete();
 
 private:
   void passiveRemovedHandler(Clause* cl);
@@ -161,6 +166,7 @@ private:
   LiteralSelector& getSosLiteralSelector();
 
   void handleEmptyClause(Clause* cl);
+  void importLemmas();
   Clause* doImmediateSimplification(Clause* cl);
   MainLoopResult saturateImpl();
   SmartPtr<IndexManager> _imgr;
@@ -210,6 +216,17 @@ protected:
   SymElOutput* _symEl;
   AnswerLiteralManager* _answerLiteralManager;
   Instantiation* _instantiation;
+  LemmaExchange* _lemmaExchange;
+  Checkpoint* _checkpoint;
+  SliceProgress* _sliceProgress;
+
+  /**
+   * Clauses retained since the unprocessed queue was last emptied, used for
+   * the unprocessed_variant_deletion option. The index is 0 if the option is off
+   * or the algorithm is not Discount.
+   */
+  ScopedPtr<HashingClauseVariantIndex> _unprocessedVariants;
+  RCClauseStack _unprocessedRetained;
 
 
   SubscriptionData _passiveContRemovalSData;
@@ -0,0 +1,136 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SliceProgress.cpp
+ * Implements class SliceProgress.
+ */
+
+#include <cerrno>
+#include <climits>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "Lib/Exception.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
+
+#include "ClauseContainer.hpp"
+
+#include "SliceProgress.hpp"
+
+/** Number of reports, i.e. of slices that can run at the same time */
+#define SLICE_PROGRESS_REPORTS 256
+/** Milliseconds between two reports of a slice */
+#define SLICE_PROGRESS_INTERVAL 100
+
+namespace Saturation
+{
+
+using namespace Shell;
+
+SliceProgress* SliceProgress::s_instance = 0;
+
+/**
+ * Create the reports. To be called in the portfolio process before
+ * the slices are forked.
+ */
+void SliceProgress::init()
+{
+  CALL("SliceProgress::init");
+  ASS(!s_instance);
+
+  s_instance = new SliceProgress();
+}
+
+SliceProgress::SliceProgress()
+: _own(0), _nextReport(0)
+{
+  CALL("SliceProgress::SliceProgress");
+
+  errno=0;
+  void* mem = mmap(0, sizeof(Report) * SLICE_PROGRESS_REPORTS, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(mem==MAP_FAILED) {
+    SYSTEM_FAIL("Cannot map shared memory.",errno);
+  }
+  // anonymous mappings are zeroed, so all reports are free
+  _reports = static_cast<Report*>(mem);
+}
+
+/**
+ * Write the progress of the current slice into its report and adopt the
+ * time limit set by the portfolio process.
+ *
+ * The report is claimed with the first call. If all reports are taken,
+ * the slice runs without reporting.
+ */
+void SliceProgress::report(const PassiveClauseContainer& passive)
+{
+  CALL("SliceProgress::report");
+
+  int now = env.timer->elapsedMilliseconds();
+  _nextReport = now + SLICE_PROGRESS_INTERVAL;
+
+  if(!_own) {
+    pid_t pid = getpid();
+    for(unsigned i=0;i<SLICE_PROGRESS_REPORTS && !_own;i++) {
+      Report* r = _reports + (pid + i) % SLICE_PROGRESS_REPORTS;
+      if(__sync_bool_compare_and_swap(&r->pid, 0, pid)) {
+        r->timeLimit = env.options->timeLimitInDeciseconds();
+        _own = r;
+      }
+    }
+    if(!_own) {
+      _nextReport = INT_MAX;
+      return;
+    }
+  }
+
+  _own->activations = env.statistics->activeClauses;
+  _own->limited = passive.weightLimited() || passive.ageLimited();
+  _own->time = now / 100;
+
+  int limit = _own->timeLimit;
+  if(limit != env.options->timeLimitInDeciseconds()) {
+    env.options->setTimeLimitInDeciseconds(limit);
+  }
+}
+
+/** Return the report of the slice running in process @b pid, or 0 if it has none */
+SliceProgress::Report* SliceProgress::find(pid_t pid)
+{
+  CALL("SliceProgress::find");
+
+  for(unsigned i=0;i<SLICE_PROGRESS_REPORTS;i++) {
+    Report* r = _reports + (pid + i) % SLICE_PROGRESS_REPORTS;
+    if(r->pid == pid) {
+      return r;
+    }
+  }
+  return 0;
+}
+
+/** Free the report of the finished slice that ran in process @b pid */
+void SliceProgress::release(pid_t pid)
+{
+  CALL("SliceProgress::release");
+
+  Report* r = find(pid);
+  if(r) {
+    r->timeLimit = 0;
+    r->time = 0;
+    r->activations = 0;
+    r->limited = false;
+    r->pid = 0;
+  }
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SliceProgress.hpp
+ * Defines class SliceProgress.
+ */
+
+#ifndef __SliceProgress__
+#define __SliceProgress__
+
+#include <sys/types.h>
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Timer.hpp"
+
+namespace Saturation {
+
+using namespace Lib;
+
+/**
+ * Progress reports of the slices of a portfolio run (see the
+ * adaptive_slices option).
+ *
+ * The reports live in memory created by the portfolio process before the
+ * slices are forked and shared with all of them. Each slice periodically
+ * writes its counters into its own report, and the portfolio process reads
+ * them to decide which slices to stop early and which ones to let run longer.
+ * The portfolio process changes the time limit of a slice by writing it into
+ * the report, and the slice adopts it with its next report.
+ *
+ * The fields are single words written by one process at a time, so no
+ * locking is needed to read values that are at most one report old.
+ */
+class SliceProgress
+{
+public:
+  CLASS_NAME(SliceProgress);
+  USE_ALLOCATOR(SliceProgress);
+
+  struct Report {
+    /** process of the slice, or 0 if the report is free */
+    volatile pid_t pid;
+    /** time limit of the slice in deciseconds */
+    volatile int timeLimit;
+    /** time of the last report in deciseconds since the start of the slice */
+    volatile int time;
+    /** clauses activated so far */
+    volatile unsigned activations;
+    /** true if the passive container discards clauses because of LRS limits */
+    volatile bool limited;
+  };
+
+  static void init();
+  /** Return the reports of the current portfolio run, or 0 if there are none */
+  static SliceProgress* instance() { return s_instance; }
+
+  /**
+   * Report the progress of the current slice if the last report is
+   * old enough. To be called after each step of the saturation.
+   */
+  void onStep(const PassiveClauseContainer& passive)
+  {
+    if(env.timer->elapsedMilliseconds() >= _nextReport) {
+      report(passive);
+    }
+  }
+
+  Report* find(pid_t pid);
+  void release(pid_t pid);
+
+private:
+  SliceProgress();
+
+  void report(const PassiveClauseContainer& passive);
+
+  static SliceProgress* s_instance;
+
+  /** the shared reports */
+  Report* _reports;
+  /** report of the current slice, or 0 if it has not reported yet */
+  Report* _own;
+  /** time of the next report in milliseconds */
+  int _nextReport;
+};
+
+}
+
+#endif // __SliceProgress__
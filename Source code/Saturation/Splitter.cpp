@@ -20,6 +20,7 @@
 #include "Lib/Environment.hpp"
 #include "Lib/IntUnionFind.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/ScopedLet.hpp"
 #include "Lib/SharedSet.hpp"
 #include "Lib/TimeCounter.hpp"
 #include "Lib/Timer.hpp"
@@ -39,12 +40,15 @@
 #include "SAT/SATInference.hpp"
 #include "SAT/MinimizingSolver.hpp"
 #include "SAT/BufferedSolver.hpp"
+#include "SAT/CDCLSolver.hpp"
 #include "SAT/FallbackSolverWrapper.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
 #include "DP/ShortConflictMetaDP.hpp"
 
+#include "Indexing/Index.hpp"
+
 #include "SaturationAlgorithm.hpp"
 
 namespace Saturation
@@ -69,6 +73,9 @@ void SplittingBranchSelector::init()
     case Options::SatSolver::MINISAT:
       _solver = new MinisatInterfacing(_parent.getOptions(),true);
       break;      
+    case Options::SatSolver::CDCL:
+      _solver = new CDCLSolver(_parent.getOptions(),true);
+      break;
 #if VZ3
     case Options::SatSolver::Z3:
       { BYPASSING_ALLOCATOR
@@ -710,6 +717,9 @@ void Splitter::init(SaturationAlgorithm* sa)
 
   _fastRestart = opts.splittingFastRestart();
   _deleteDeactivated = opts.splittingDeleteDeactivated();
+  // with deleted children nothing ever comes back, so there is nothing to gain
+  _lazyIndexRemoval = opts.splittingLazyIndexRemoval() &&
+      _deleteDeactivated != Options::SplittingDeleteDeactivated::ON;
 
   if (opts.useHashingVariantIndex()) {
     _componentIdx = new HashingClauseVariantIndex();
@@ -1743,6 +1753,9 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
   
   SplitSet* backtracked = SplitSet::getFromArray(toRemove.begin(), toRemove.size());
 
+  // the children are likely to come back, so the indices only mark them as suspended
+  ScopedLet<bool> suspendLet(Indexing::Index::s_suspendRemovals, _lazyIndexRemoval);
+
   // ensure all children are backtracked
   // i.e. removed from _sa and reference counter dec
   SplitSet::Iterator blit(*backtracked);
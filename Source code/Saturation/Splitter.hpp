@@ -252,6 +252,8 @@ private:
   unsigned _flushPeriod;
   float _flushQuotient;
   Options::SplittingDeleteDeactivated _deleteDeactivated;
+  /** keep index entries of deactivated children, see Index::s_suspendRemovals */
+  bool _lazyIndexRemoval;
   Options::SplittingCongruenceClosure _congruenceClosure;
 #if VZ3
   bool hasSMTSolver;
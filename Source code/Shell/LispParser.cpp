@@ -101,13 +101,24 @@ void LispParser::parse(List** expr0)
 {
   CALL("LispParser::parse/1");
 
+  Token t;
+  parse(expr0, t);
+} // parse()
+
+/**
+ * Parse into @b expr0 using @b t for reading tokens. @b t holds the last
+ * token read by the caller, so that an unexpected end of input is reported
+ * at its line.
+ */
+void LispParser::parse(List** expr0, Token& t)
+{
+  CALL("LispParser::parse/2");
+
   static Stack<List**> stack;
   stack.reset();
 
   stack.push(expr0);
 
-  Token t;
-
   List** expr = expr0;
   for(;;) {
   new_parsing_level:
@@ -155,10 +166,82 @@ void LispParser::parse(List** expr0)
   parsing_level_done:
     ASS(stack.isNonEmpty());
     expr = stack.pop();
+    if (stack.isEmpty()) {
+      // closed the list we were called for by parseNext()
+      return;
+    }
   }
 
 } // parse()
 
+/**
+ * Read the next top-level expression, or return 0 at the end of input
+ */
+LispParser::Expression* LispParser::parseNext()
+{
+  CALL("LispParser::parseNext");
+  ASS_EQ(_balance, 0);
+
+  Token t;
+  _lexer.readToken(t);
+  switch (t.tag) {
+  case TT_EOF:
+    return 0;
+  case TT_RPAR:
+    throw Exception("unmatched right parenthesis",t);
+  case TT_LPAR:
+    {
+      _balance++;
+      Expression* result = new Expression(LIST);
+      parse(&result->list, t);
+      return result;
+    }
+  case TT_NAME:
+  case TT_INTEGER:
+  case TT_REAL:
+    return new Expression(ATOM,t.text);
+  default:
+    ASSERTION_VIOLATION;
+  }
+} // parseNext()
+
+/**
+ * Destroy @b expr and all its subexpressions
+ */
+void LispParser::destroy(Expression* expr)
+{
+  CALL("LispParser::destroy");
+
+  static Stack<Expression*> toDo;
+  toDo.reset();
+  toDo.push(expr);
+  while (toDo.isNonEmpty()) {
+    Expression* e = toDo.pop();
+    for (List* l = e->list; l; l = l->tail()) {
+      toDo.push(l->head());
+    }
+    List::destroy(e->list);
+    delete e;
+  }
+} // destroy()
+
+/**
+ * Return a copy of this expression that shares no subexpressions with it
+ */
+LispParser::Expression* LispParser::Expression::clone() const
+{
+  CALL("LispParser::Expression::clone");
+
+  Expression* result = new Expression(tag,str);
+  result->list = List::copy(list);
+  List::RefIterator it(result->list);
+  while (it.hasNext()) {
+    Expression*& sub = it.next();
+    sub = sub->clone();
+  }
+  return result;
+} // LispParser::Expression::clone
+
 /**
  * Return a LISP string corresponding to this expression
  * @since 26/08/2009 Redmond
@@ -467,6 +550,50 @@ void LispListReader::acceptList()
   readList();
 }
 
+LispStreamReader::~LispStreamReader()
+{
+  CALL("LispStreamReader::~LispStreamReader");
+
+  if (_curr) {
+    LispParser::destroy(_curr);
+  }
+  if (_next) {
+    LispParser::destroy(_next);
+  }
+}
+
+bool LispStreamReader::hasNext()
+{
+  CALL("LispStreamReader::hasNext");
+
+  if (!_next) {
+    _next = _parser.parseNext();
+  }
+  return _next;
+}
+
+LExpr* LispStreamReader::next()
+{
+  CALL("LispStreamReader::next");
+  ALWAYS(hasNext());
+
+  if (_curr) {
+    LispParser::destroy(_curr);
+  }
+  _curr = _next;
+  _next = 0;
+  return _curr;
+}
+
+void LispStreamReader::acceptEOL()
+{
+  CALL("LispStreamReader::acceptEOL");
+
+  if (hasNext()) {
+    USER_ERROR("<eol> expected: "+_next->toString());
+  }
+}
+
 void LispListReader::acceptEOL()
 {
   CALL("LispListReader::acceptEOL");
@@ -72,6 +72,7 @@ public:
 	list(0)
     {}
     vstring toString(bool outerParentheses=true) const;
+    Expression* clone() const;
 
     bool isList() const { return tag==LIST; }
     bool isAtom() const { return tag==ATOM; }
@@ -87,6 +88,9 @@ public:
   explicit LispParser(LispLexer& lexer);
   Expression* parse();
   void parse(List**);
+  Expression* parseNext();
+
+  static void destroy(Expression* expr);
 
   /**
    * Class Exception. Implements parser exceptions.
@@ -104,6 +108,8 @@ public:
   }; // Exception
 
 private:
+  void parse(List** expr, Token& t);
+
   /** lexer supplying tokens */
   LispLexer& _lexer;
   /** balance of parenthesis */
@@ -159,6 +165,30 @@ private:
   LExprList::Iterator it;
 };
 
+/**
+ * Reads the top-level expressions of the input of a LispParser one by one,
+ * with the part of the LispListReader interface needed for that
+ *
+ * An expression returned by next() is destroyed when the reader moves past
+ * it, so the whole input never has to be kept in memory.
+ */
+class LispStreamReader {
+public:
+  explicit LispStreamReader(LispParser& parser) : _parser(parser), _curr(0), _next(0) {}
+  ~LispStreamReader();
+
+  bool hasNext();
+  LExpr* next();
+
+  void acceptEOL();
+private:
+  LispParser& _parser;
+  /** expression last returned by next() */
+  LExpr* _curr;
+  /** expression read ahead by hasNext() */
+  LExpr* _next;
+};
+
 class LispListWriter
 {
 public:
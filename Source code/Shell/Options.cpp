@@ -91,6 +91,11 @@ void Options::init()
     _memoryLimit.addHardConstraint(lessThanEq((unsigned)Lib::System::getSystemMemory()));
 #endif
 
+    _releaseFreedMemory = BoolOptionValue("release_freed_memory","",false);
+    _releaseFreedMemory.description="Return the memory of freed large objects to the system instead of keeping it for reuse."
+      " Lowers the memory footprint of long runs whose large data structures shrink, at the cost of more system calls";
+    _lookup.insert(&_releaseFreedMemory);
+
 #ifdef __linux__
   _instructionLimit = UnsignedOptionValue("instruction_limit","i",0);
   _instructionLimit.description="Limit the number (in millions) of executed instructions (excluding the kernel ones).";
@@ -162,6 +167,13 @@ void Options::init()
     _lookup.insert(&_schedule);
     _schedule.reliesOnHard(UsingPortfolioTechnology());
 
+    _scheduleFile = StringOptionValue("schedule_file","","");
+    _scheduleFile.description = "Read the schedule to be run by the portfolio mode from this file instead of using the schedule"
+      " option. Each line of the file is quick or fallback, followed by conditions on the problem, such as cat=FNE,"
+      " props&4, props!&4, props=4, atoms<1000 or atoms>1000, and by a slice. A slice is run if all its conditions hold";
+    _lookup.insert(&_scheduleFile);
+    _scheduleFile.reliesOn(UsingPortfolioTechnology());
+
     _multicore = UnsignedOptionValue("cores","",1);
     _multicore.description = "When running in portfolio modes (including casc or smtcomp modes) specify the number of cores, set to 0 to use maximum";
     _lookup.insert(&_multicore);
@@ -172,6 +184,26 @@ void Options::init()
     _lookup.insert(&_slowness);
     _slowness.reliesOn(UsingPortfolioTechnology());
 
+    _sharedPreprocessing = UnsignedOptionValue("shared_preprocessing","",0);
+    _sharedPreprocessing.description = "When running in portfolio modes, keep up to this many preprocessed copies of the problem,"
+      " one for each combination of options relevant to preprocessing, and start the slices using the same combination"
+      " from the copy instead of preprocessing again (Linux only). Set to 0 to preprocess in every slice";
+    _lookup.insert(&_sharedPreprocessing);
+    _sharedPreprocessing.reliesOn(UsingPortfolioTechnology());
+
+    _lemmaExchange = UnsignedOptionValue("lemma_exchange","",0);
+    _lemmaExchange.description = "When running in portfolio modes, let the slices share the derived unit clauses"
+      " of at most this weight that do not depend on AVATAR assumptions and only use symbols of the input problem."
+      " Set to 0 to disable";
+    _lookup.insert(&_lemmaExchange);
+    _lemmaExchange.reliesOn(UsingPortfolioTechnology());
+
+    _adaptiveSlices = BoolOptionValue("adaptive_slices","",false);
+    _adaptiveSlices.description = "When running in portfolio modes, let the slices report their progress and use it to"
+      " stop stalled slices before their time limit and give the time saved to slices that are still making progress";
+    _lookup.insert(&_adaptiveSlices);
+    _adaptiveSlices.reliesOn(UsingPortfolioTechnology());
+
     _ltbLearning = ChoiceOptionValue<LTBLearning>("ltb_learning","ltbl",LTBLearning::OFF,{"on","off","biased"});
     _ltbLearning.description = "Perform learning in LTB mode";
     _lookup.insert(&_ltbLearning);
@@ -292,6 +324,20 @@ void Options::init()
     _lookup.insert(&_printProofToFile);
     _printProofToFile.tag(OptionTag::OUTPUT);
 
+    _checkpointFile = StringOptionValue("checkpoint_file","","");
+    _checkpointFile.description="Periodically write the active and passive clauses not depending on AVATAR assumptions"
+                                " into this file in TPTP. A killed run can be restarted by using the file as its input."
+                                " If some clauses could not be written (e.g. due to AVATAR or LRS), the restarted run"
+                                " never reports satisfiability.";
+    _lookup.insert(&_checkpointFile);
+    _checkpointFile.tag(OptionTag::OUTPUT);
+
+    _checkpointInterval = UnsignedOptionValue("checkpoint_interval","",600);
+    _checkpointInterval.description="Seconds between two checkpoints written to the checkpoint_file."
+                                    " A checkpoint is also written when the time limit is reached. Zero disables checkpointing.";
+    _lookup.insert(&_checkpointInterval);
+    _checkpointInterval.tag(OptionTag::OUTPUT);
+
     _proofExtra = ChoiceOptionValue<ProofExtra>("proof_extra","",ProofExtra::OFF,{"off","free","full"});
     _proofExtra.description="Add extra detail to proofs:\n "
       "- free uses known information only\n" 
@@ -344,6 +390,11 @@ void Options::init()
     _lookup.insert(&_timeStatistics);
     _timeStatistics.tag(OptionTag::OUTPUT);
 
+    _allocatorStatistics = BoolOptionValue("allocator_statistics","",false);
+    _allocatorStatistics.description="Show how many pieces of each size were allocated by the memory allocator";
+    _lookup.insert(&_allocatorStatistics);
+    _allocatorStatistics.tag(OptionTag::OUTPUT);
+
 //*********************** Input  ***********************
 
     _include = StringOptionValue("include","","");
@@ -351,6 +402,13 @@ void Options::init()
     _lookup.insert(&_include);
     _include.tag(OptionTag::INPUT);
 
+    _preprocessingCache = StringOptionValue("preprocessing_cache","","");
+    _preprocessingCache.description="Directory in which preprocessed problems are stored, keyed by the content of the input files"
+                                    " and the options relevant to preprocessing. A problem found there is loaded instead of being"
+                                    " parsed and preprocessed again. Only first-order problems without sorts and theories are stored";
+    _lookup.insert(&_preprocessingCache);
+    _preprocessingCache.tag(OptionTag::INPUT);
+
     _inputFile= InputFileOptionValue("input_file","","",this);
     _inputFile.description="Problem file to be solved (if not specified, standard input is used)";
     _lookup.insert(&_inputFile);
@@ -746,6 +804,15 @@ void Options::init()
                 And(_saturationAlgorithm.is(equal(SaturationAlgorithm::INST_GEN)),_instGenWithResolution.is(equal(true))));
     };
 
+    _lazyPassive = BoolOptionValue("lazy_passive","",false);
+    _lazyPassive.description="Keep superposition conclusions in the passive container as their premises and unifier"
+                             " and only build their literals when they are selected. Immediate simplifications are"
+                             " then also postponed until selection. The clause objects themselves are still allocated, so this saves only"
+                             " the side literals and the simplifications. Not used with splitting or symbol elimination output";
+    _lazyPassive.reliesOn(_saturationAlgorithm.is(equal(SaturationAlgorithm::DISCOUNT)));
+    _lazyPassive.tag(OptionTag::SATURATION);
+    _lookup.insert(&_lazyPassive);
+
     _sos = ChoiceOptionValue<Sos>("sos","sos",Sos::OFF,{"all","off","on","theory"});
     _sos.description=
     "Set of support strategy. All formulas annotated as axioms are put directly among active clauses, without performing any inferences between them."
@@ -849,6 +916,15 @@ void Options::init()
     _fmbEnumerationStrategy.reliesOn(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
     _fmbEnumerationStrategy.tag(OptionTag::FMB);
 
+    _fmbIncremental = BoolOptionValue("fmb_incremental","fmbinc",false);
+    _fmbIncremental.description = "Keep the SAT solver when moving to larger model sizes. Only the instances"
+                                  " for the new domain elements are added and clauses valid only for the old sizes"
+                                  " are switched off. Variable elimination in minisat is not used then.";
+    _lookup.insert(&_fmbIncremental);
+    _fmbIncremental.reliesOn(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbIncremental.setRandomChoices({"on","off"});
+    _fmbIncremental.tag(OptionTag::FMB);
+
     _selection = SelectionOptionValue("selection","s",10);
     _selection.description=
     "Selection methods 2,3,4,10,11 are complete by virtue of extending Maximal i.e. they select the best among maximal. Methods 1002,1003,1004,1010,1011 relax this restriction and are therefore not complete.\n"
@@ -1336,6 +1412,14 @@ void Options::init()
     _backwardSubsumption.reliesOn(InferencingSaturationAlgorithm());
     _backwardSubsumption.setRandomChoices({"on","off"});
 
+    _backwardSubsumptionIndex = ChoiceOptionValue<BackwardSubsumptionIndex>("backward_subsumption_index","bsi",
+                BackwardSubsumptionIndex::LITERAL,{"literal","feature_vector"});
+    _backwardSubsumptionIndex.description=
+       "Index used to retrieve the clauses possibly subsumed by a newly derived clause in backward subsumption. Literal queries a literal index for instances of one literal of the clause. Feature_vector uses a trie of clause feature vectors (numbers of literals, predicate and function symbol occurrences) and is cheaper on problems with many clauses";
+    _lookup.insert(&_backwardSubsumptionIndex);
+    _backwardSubsumptionIndex.tag(OptionTag::INFERENCES);
+    _backwardSubsumptionIndex.reliesOn(_backwardSubsumption.is(notEqual(Subsumption::OFF)));
+
     _backwardSubsumptionResolution = ChoiceOptionValue<Subsumption>("backward_subsumption_resolution","bsr",
                     Subsumption::OFF,{"off","on","unit_only"});
     _backwardSubsumptionResolution.description=
@@ -1506,6 +1590,14 @@ void Options::init()
     _forwardSubsumption.tag(OptionTag::INFERENCES);
     _forwardSubsumption.setRandomChoices({"on","on","on","on","on","on","on","on","on","off"}); // turn this off rarely
 
+    _unprocessedVariantDeletion = BoolOptionValue("unprocessed_variant_deletion","uvd",false);
+    _unprocessedVariantDeletion.description="Delete a new clause if a variant of it with the same AVATAR assumptions"
+      " was already retained since the unprocessed queue was last emptied. Discount only, where forward"
+      " subsumption does not see passive clauses; the other algorithms already delete such duplicates.";
+    _lookup.insert(&_unprocessedVariantDeletion);
+    _unprocessedVariantDeletion.tag(OptionTag::INFERENCES);
+    _unprocessedVariantDeletion.reliesOn(_saturationAlgorithm.is(equal(SaturationAlgorithm::DISCOUNT)));
+
     _forwardSubsumptionResolution = BoolOptionValue("forward_subsumption_resolution","fsr",true);
     _forwardSubsumptionResolution.description="Perform forward subsumption resolution.";
     _lookup.insert(&_forwardSubsumptionResolution);
@@ -1961,6 +2053,16 @@ void Options::init()
     _splittingDeleteDeactivated.reliesOn(_splitting.is(equal(true)));
     _splittingDeleteDeactivated.setRandomChoices({"on","large","off"});
 
+    _splittingLazyIndexRemoval = BoolOptionValue("avatar_lazy_index_removal","alir",false);
+    _splittingLazyIndexRemoval.description=
+    "When AVATAR deactivates clauses, only mark them as suspended in the indices instead of removing them. "
+    "Reactivated clauses then reuse their entries and the indices are cleaned up in batches. "
+    "Has no effect with avatar_delete_deactivated on.";
+    _lookup.insert(&_splittingLazyIndexRemoval);
+    _splittingLazyIndexRemoval.tag(OptionTag::AVATAR);
+    _splittingLazyIndexRemoval.reliesOn(_splitting.is(equal(true)));
+    _splittingLazyIndexRemoval.setRandomChoices({"on","off"});
+
 
     _splittingFlushPeriod = UnsignedOptionValue("avatar_flush_period","afp",0);
     _splittingFlushPeriod.description=
@@ -2014,21 +2116,26 @@ void Options::init()
 
 //*********************** SAT solver (used in various places)  ***********************
     _satSolver = ChoiceOptionValue<SatSolver>("sat_solver","sas",SatSolver::MINISAT, {
-      "minisat"
+      "minisat",
+      "cdcl"
 #if VZ3
       ,"z3"
 #endif
     });
     _satSolver.description=
-    "Select the SAT solver to be used throughout the solver. This will be used in AVATAR (for splitting) when the saturation algorithm is discount,lrs or otter and in instance generation for selection and global subsumption.";
+    "Select the SAT solver to be used throughout the solver. This will be used in AVATAR (for splitting) when the saturation algorithm is discount,lrs or otter and in instance generation for selection and global subsumption. "
+    "The finite model builder uses the cdcl solver if selected and minisat otherwise. "
+    "cdcl is an in-tree solver with glue based restarts, chronological backtracking and learnt clause vivification.";
     _lookup.insert(&_satSolver);
     // in principle, global_subsumption and instgen also depend on the SAT solver choice, however,
     // 1) currently, neither is actually supporting Z3
     // 2) there is no reason why only one sat solver should be driving all three, so more than on _satSolver-like option should be considered in the future
-    _satSolver.reliesOn(_splitting.is(equal(true)));
+    _satSolver.reliesOn(Or(_splitting.is(equal(true)),
+        _saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING))));
     _satSolver.tag(OptionTag::SAT);
     _satSolver.setRandomChoices({
-      "minisat"
+      "minisat",
+      "cdcl"
 #if VZ3
       ,"z3"
 #endif
@@ -2115,6 +2222,22 @@ void Options::init()
     _termOrdering.tag(OptionTag::SATURATION);
     _lookup.insert(&_termOrdering);
 
+    _orderingCache = UnsignedOptionValue("ordering_cache","",0);
+    _orderingCache.description="Remember the results of comparing shared terms in the term ordering in a cache of at most"
+                               " this many entries (rounded down to a power of two). Set to 0 to disable";
+    _orderingCache.reliesOn(InferencingSaturationAlgorithm());
+    _orderingCache.tag(OptionTag::SATURATION);
+    _lookup.insert(&_orderingCache);
+
+    _indexNodeLayout = ChoiceOptionValue<IndexNodeLayout>("index_node_layout","inl",IndexNodeLayout::SKIP_LIST,
+                                                          {"skip_list","sorted_array"});
+    _indexNodeLayout.description="How substitution tree nodes with many children or leaves with many entries are stored."
+                                 " skip_list links them in skip lists, sorted_array keeps them in contiguous sorted arrays"
+                                 " searched by binary search on inline top symbol keys.";
+    _indexNodeLayout.reliesOn(InferencingSaturationAlgorithm());
+    _indexNodeLayout.tag(OptionTag::SATURATION);
+    _lookup.insert(&_indexNodeLayout);
+
     _symbolPrecedence = ChoiceOptionValue<SymbolPrecedence>("symbol_precedence","sp",SymbolPrecedence::ARITY,
                                                             {"arity","occurrence","reverse_arity","scramble",
                                                              "frequency","reverse_frequency",
@@ -3011,7 +3134,6 @@ void Options::readOptionsString(vstring optionsString,bool assign)
                 USER_ERROR("value "+value+" for option "+ param +" not known");
                 break;
               case IgnoreMissing::WARN:
-                env.beginOutput();
                 if (outputAllowed()) {
                   env.beginOutput();
                   addCommentSignForSZS(env.out());
@@ -3037,7 +3159,6 @@ void Options::readOptionsString(vstring optionsString,bool assign)
         USER_ERROR("option "+param+" not known");
         break;
       case IgnoreMissing::WARN:
-        env.beginOutput();
         if (outputAllowed()) {
           env.beginOutput();
           addCommentSignForSZS(env.out());
@@ -3190,7 +3311,10 @@ vstring Options::generateEncodedOptions() const
     forbidden.insert(&_mode);
     forbidden.insert(&_testId); // is this old version of decode?
     forbidden.insert(&_include);
+    forbidden.insert(&_scheduleFile);
+    forbidden.insert(&_preprocessingCache);
     forbidden.insert(&_printProofToFile);
+    forbidden.insert(&_checkpointFile);
     forbidden.insert(&_problemName);
     forbidden.insert(&_inputFile);
     forbidden.insert(&_randomStrategy);
@@ -3219,6 +3343,165 @@ vstring Options::generateEncodedOptions() const
   return res.str();
 }
 
+/**
+ * Return a string identifying the values of all options that can influence
+ * preprocessing. Two strategies with the same string start saturation from
+ * the same preprocessed problem, which lets the portfolio mode share it
+ * among its slices (see the shared_preprocessing option).
+ */
+vstring Options::generateEncodedPreprocessingOptions() const
+{
+  CALL("Options::generateEncodedPreprocessingOptions");
+
+  BYPASSING_ALLOCATOR;
+  vostringstream res;
+
+  // Record options that are only consulted after preprocessing
+  static Set<const AbstractOptionValue*> ignored;
+  //we initialize the set if there's nothing inside
+  if (ignored.size()==0) {
+    //bookkeeping
+    ignored.insert(&_timeLimitInDeciseconds);
+    ignored.insert(&_mode);
+    ignored.insert(&_scheduleFile);
+    ignored.insert(&_testId);
+    ignored.insert(&_include);
+    ignored.insert(&_preprocessingCache);
+    ignored.insert(&_printProofToFile);
+    ignored.insert(&_checkpointFile);
+    ignored.insert(&_checkpointInterval);
+    ignored.insert(&_problemName);
+    ignored.insert(&_inputFile);
+    ignored.insert(&_randomStrategy);
+    ignored.insert(&_encode);
+    ignored.insert(&_decode);
+    ignored.insert(&_ignoreMissing);
+    ignored.insert(&_multicore);
+    ignored.insert(&_slowness);
+    ignored.insert(&_sharedPreprocessing);
+    ignored.insert(&_lemmaExchange);
+    ignored.insert(&_adaptiveSlices);
+
+    //saturation, except for finite model building which is dealt with below
+    ignored.insert(&_saturationAlgorithm);
+    ignored.insert(&_selection);
+    ignored.insert(&_ageWeightRatio);
+    ignored.insert(&_ageWeightRatioShape);
+    ignored.insert(&_ageWeightRatioShapeFrequency);
+    ignored.insert(&_lrsFirstTimeCheck);
+    ignored.insert(&_lrsWeightLimitOnly);
+    ignored.insert(&_simulatedTimeLimit);
+    ignored.insert(&_nonGoalWeightCoefficient);
+    ignored.insert(&_restrictNWCtoGC);
+    ignored.insert(&_nonliteralsInClauseWeight);
+    ignored.insert(&_increasedNumeralWeight);
+    ignored.insert(&_sosTheoryLimit);
+    ignored.insert(&_useTheorySplitQueues);
+    ignored.insert(&_theorySplitQueueRatios);
+    ignored.insert(&_theorySplitQueueCutoffs);
+    ignored.insert(&_theorySplitQueueExpectedRatioDenom);
+    ignored.insert(&_theorySplitQueueLayeredArrangement);
+    // not the sine level split queues, preprocessing assigns sine levels to clauses for them
+    ignored.insert(&_useAvatarSplitQueues);
+    ignored.insert(&_avatarSplitQueueRatios);
+    ignored.insert(&_avatarSplitQueueCutoffs);
+    ignored.insert(&_avatarSplitQueueLayeredArrangement);
+    ignored.insert(&_usePositiveLiteralSplitQueues);
+    ignored.insert(&_positiveLiteralSplitQueueRatios);
+    ignored.insert(&_positiveLiteralSplitQueueCutoffs);
+    ignored.insert(&_positiveLiteralSplitQueueLayeredArrangement);
+    ignored.insert(&_termOrdering);
+    ignored.insert(&_orderingCache);
+    ignored.insert(&_lazyPassive);
+    ignored.insert(&_symbolPrecedence);
+    ignored.insert(&_symbolPrecedenceBoost);
+    ignored.insert(&_literalComparisonMode);
+    ignored.insert(&_literalMaximalityAftercheck);
+    ignored.insert(&_unificationWithAbstraction);
+    ignored.insert(&_sos);
+
+    //inferences and simplifications
+    ignored.insert(&_binaryResolution);
+    ignored.insert(&_unitResultingResolution);
+    ignored.insert(&_superpositionFromVariables);
+    ignored.insert(&_simultaneousSuperposition);
+    ignored.insert(&_innerRewriting);
+    ignored.insert(&_condensation);
+    ignored.insert(&_extensionalityResolution);
+    ignored.insert(&_forwardSubsumption);
+    ignored.insert(&_unprocessedVariantDeletion);
+    ignored.insert(&_indexNodeLayout);
+    ignored.insert(&_forwardSubsumptionResolution);
+    ignored.insert(&_forwardSubsumptionDemodulation);
+    ignored.insert(&_forwardSubsumptionDemodulationMaxMatches);
+    ignored.insert(&_forwardDemodulation);
+    ignored.insert(&_backwardSubsumption);
+    ignored.insert(&_backwardSubsumptionIndex);
+    ignored.insert(&_backwardSubsumptionResolution);
+    ignored.insert(&_backwardSubsumptionDemodulation);
+    ignored.insert(&_backwardSubsumptionDemodulationMaxMatches);
+    ignored.insert(&_backwardDemodulation);
+    ignored.insert(&_globalSubsumption);
+    ignored.insert(&_globalSubsumptionSatSolverPower);
+    ignored.insert(&_globalSubsumptionExplicitMinim);
+    ignored.insert(&_globalSubsumptionAvatarAssumptions);
+    ignored.insert(&_demodulationRedundancyCheck);
+    ignored.insert(&_termAlgebraInferences);
+#if VZ3
+    ignored.insert(&_theoryInstAndSimp);
+    ignored.insert(&_thiGeneralise);
+    ignored.insert(&_thiTautologyDeletion);
+#endif
+    ignored.insert(&_priortyToLongReducts);
+    ignored.insert(&_newTautologyDel);
+    ignored.insert(&_useHashingVariantIndex);
+
+    //instance generation
+    ignored.insert(&_instGenBigRestartRatio);
+    ignored.insert(&_instGenPassiveReactivation);
+    ignored.insert(&_instGenResolutionInstGenRatio);
+    ignored.insert(&_instGenRestartPeriod);
+    ignored.insert(&_instGenRestartPeriodQuotient);
+    ignored.insert(&_instGenWithResolution);
+    ignored.insert(&_instGenSelection);
+
+    //splitting
+    ignored.insert(&_splitting);
+    ignored.insert(&_splitAtActivation);
+    ignored.insert(&_splittingAddComplementary);
+    ignored.insert(&_splittingCongruenceClosure);
+    ignored.insert(&_splittingEagerRemoval);
+    ignored.insert(&_splittingFlushPeriod);
+    ignored.insert(&_splittingFlushQuotient);
+    ignored.insert(&_splittingAvatimer);
+    ignored.insert(&_splittingNonsplittableComponents);
+    ignored.insert(&_splittingMinimizeModel);
+    ignored.insert(&_splittingLiteralPolarityAdvice);
+    ignored.insert(&_splittingDeleteDeactivated);
+    ignored.insert(&_splittingLazyIndexRemoval);
+    ignored.insert(&_splittingFastRestart);
+    ignored.insert(&_splittingBufferedSolver);
+    ignored.insert(&_ccUnsatCores);
+    ignored.insert(&_satSolver);
+  }
+
+  //distinct groups are expanded differently for finite model building
+  if (_saturationAlgorithm.actualValue == SaturationAlgorithm::FINITE_MODEL_BUILDING) {
+    res << "fmb";
+  }
+
+  VirtualIterator<AbstractOptionValue*> options = _lookup.values();
+
+  while(options.hasNext()){
+    AbstractOptionValue* option = options.next();
+    if(!ignored.contains(option) && option->is_set && !option->isDefault()){
+      res << ":" << option->longName << "=" << option->getStringOfActual();
+    }
+  }
+
+  return res.str();
+}
+
 
 /**
  * True if the options are complete.
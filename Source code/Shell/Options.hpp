@@ -131,6 +131,7 @@ public:
     void readFromEncodedOptions (vstring testId);
     void readOptionsString (vstring testId,bool assign=true);
     vstring generateEncodedOptions() const;
+    vstring generateEncodedPreprocessingOptions() const;
 
     // deal with completeness
     bool complete(const Problem&) const;
@@ -445,9 +446,10 @@ public:
 
   /** Possible values for sat_solver */
   enum class SatSolver : unsigned int {
-     MINISAT = 0
+     MINISAT = 0,
+     CDCL = 1
 #if VZ3
-     ,Z3 = 1
+     ,Z3 = 2
 #endif
   };
 
@@ -506,6 +508,11 @@ public:
     UNIT_ONLY = 2
   };
 
+  enum class BackwardSubsumptionIndex : unsigned int {
+    LITERAL = 0,
+    FEATURE_VECTOR = 1
+  };
+
   enum class URResolution : unsigned int {
     EC_ONLY = 0,
     OFF = 1,
@@ -517,6 +524,11 @@ public:
     LPO = 1
   };
 
+  enum class IndexNodeLayout : unsigned int {
+    SKIP_LIST = 0,
+    SORTED_ARRAY = 1
+  };
+
   enum class SymbolPrecedence : unsigned int {
     ARITY = 0,
     OCCURRENCE = 1,
@@ -2001,6 +2013,8 @@ public:
   bool minimizeSatProofs() const { return _minimizeSatProofs.actualValue; }
   ProofExtra proofExtra() const { return _proofExtra.actualValue; }
   vstring printProofToFile() const { return _printProofToFile.actualValue; }
+  vstring checkpointFile() const { return _checkpointFile.actualValue; }
+  unsigned checkpointInterval() const { return _checkpointInterval.actualValue; }
   int naming() const { return _naming.actualValue; }
 
   bool fmbNonGroundDefs() const { return _fmbNonGroundDefs.actualValue; }
@@ -2013,17 +2027,22 @@ public:
   unsigned fmbDetectSortBoundsTimeLimit() const { return _fmbDetectSortBoundsTimeLimit.actualValue; }
   unsigned fmbSizeWeightRatio() const { return _fmbSizeWeightRatio.actualValue; }
   FMBEnumerationStrategy fmbEnumerationStrategy() const { return _fmbEnumerationStrategy.actualValue; }
+  bool fmbIncremental() const { return _fmbIncremental.actualValue; }
 
   bool flattenTopLevelConjunctions() const { return _flattenTopLevelConjunctions.actualValue; }
   LTBLearning ltbLearning() const { return _ltbLearning.actualValue; }
   vstring ltbDirectory() const { return _ltbDirectory.actualValue; }
   Mode mode() const { return _mode.actualValue; }
   Schedule schedule() const { return _schedule.actualValue; }
+  vstring scheduleFile() const { return _scheduleFile.actualValue; }
   vstring scheduleName() const { return _schedule.getStringOfValue(_schedule.actualValue); }
   void setSchedule(Schedule newVal) {  _schedule.actualValue = newVal; }
   unsigned multicore() const { return _multicore.actualValue; }
   void setMulticore(unsigned newVal) { _multicore.actualValue = newVal; }
   float slowness() const {return _slowness.actualValue; }
+  unsigned sharedPreprocessing() const { return _sharedPreprocessing.actualValue; }
+  unsigned lemmaExchange() const { return _lemmaExchange.actualValue; }
+  bool adaptiveSlices() const { return _adaptiveSlices.actualValue; }
   InputSyntax inputSyntax() const { return _inputSyntax.actualValue; }
   void setInputSyntax(InputSyntax newVal) { _inputSyntax.actualValue = newVal; }
   bool normalize() const { return _normalize.actualValue; }
@@ -2035,6 +2054,7 @@ public:
   void setNaming(int n){ _naming.actualValue = n;} //TODO: ensure global constraints
   vstring include() const { return _include.actualValue; }
   void setInclude(vstring val) { _include.actualValue = val; }
+  vstring preprocessingCache() const { return _preprocessingCache.actualValue; }
   vstring inputFile() const { return _inputFile.actualValue; }
   int activationLimit() const { return _activationLimit.actualValue; }
   int randomSeed() const { return _randomSeed.actualValue; }
@@ -2124,10 +2144,12 @@ public:
   //void setBackwardDemodulation(Demodulation newVal) { _backwardDemodulation = newVal; }
   Subsumption backwardSubsumption() const { return _backwardSubsumption.actualValue; }
   //void setBackwardSubsumption(Subsumption newVal) { _backwardSubsumption = newVal; }
+  BackwardSubsumptionIndex backwardSubsumptionIndex() const { return _backwardSubsumptionIndex.actualValue; }
   Subsumption backwardSubsumptionResolution() const { return _backwardSubsumptionResolution.actualValue; }
   bool backwardSubsumptionDemodulation() const { return _backwardSubsumptionDemodulation.actualValue; }
   unsigned backwardSubsumptionDemodulationMaxMatches() const { return _backwardSubsumptionDemodulationMaxMatches.actualValue; }
   bool forwardSubsumption() const { return _forwardSubsumption.actualValue; }
+  bool unprocessedVariantDeletion() const { return _unprocessedVariantDeletion.actualValue; }
   bool forwardLiteralRewriting() const { return _forwardLiteralRewriting.actualValue; }
   int lrsFirstTimeCheck() const { return _lrsFirstTimeCheck.actualValue; }
   int lrsWeightLimitOnly() const { return _lrsWeightLimitOnly.actualValue; }
@@ -2135,6 +2157,9 @@ public:
   int simulatedTimeLimit() const { return _simulatedTimeLimit.actualValue; }
   void setSimulatedTimeLimit(int newVal) { _simulatedTimeLimit.actualValue = newVal; }
   TermOrdering termOrdering() const { return _termOrdering.actualValue; }
+  unsigned orderingCache() const { return _orderingCache.actualValue; }
+  bool lazyPassive() const { return _lazyPassive.actualValue; }
+  IndexNodeLayout indexNodeLayout() const { return _indexNodeLayout.actualValue; }
   SymbolPrecedence symbolPrecedence() const { return _symbolPrecedence.actualValue; }
   SymbolPrecedenceBoost symbolPrecedenceBoost() const { return _symbolPrecedenceBoost.actualValue; }
   IntroducedSymbolPrecedence introducedSymbolPrecedence() const { return _introducedSymbolPrecedence.actualValue; }
@@ -2146,6 +2171,7 @@ public:
   // Return time limit in deciseconds, or 0 if there is no time limit
   int timeLimitInDeciseconds() const { return _timeLimitInDeciseconds.actualValue; }
   size_t memoryLimit() const { return _memoryLimit.actualValue; }
+  bool releaseFreedMemory() const { return _releaseFreedMemory.actualValue; }
 #ifdef __linux__
   size_t instructionLimit() const { return _instructionLimit.actualValue; }
 #endif
@@ -2218,6 +2244,7 @@ public:
   Condensation condensation() const { return _condensation.actualValue; }
   bool generalSplitting() const { return _generalSplitting.actualValue; }
   bool timeStatistics() const { return _timeStatistics.actualValue; }
+  bool allocatorStatistics() const { return _allocatorStatistics.actualValue; }
   bool splitting() const { return _splitting.actualValue; }
   void setSplitting(bool value){ _splitting.actualValue=value; }
   bool nonliteralsInClauseWeight() const { return _nonliteralsInClauseWeight.actualValue; }
@@ -2267,6 +2294,7 @@ public:
   SplittingMinimizeModel splittingMinimizeModel() const { return _splittingMinimizeModel.actualValue; }
   SplittingLiteralPolarityAdvice splittingLiteralPolarityAdvice() const { return _splittingLiteralPolarityAdvice.actualValue; }
   SplittingDeleteDeactivated splittingDeleteDeactivated() const { return _splittingDeleteDeactivated.actualValue;}
+  bool splittingLazyIndexRemoval() const { return _splittingLazyIndexRemoval.actualValue; }
   bool splittingFastRestart() const { return _splittingFastRestart.actualValue; }
   bool splittingBufferedSolver() const { return _splittingBufferedSolver.actualValue; }
   int splittingFlushPeriod() const { return _splittingFlushPeriod.actualValue; }
@@ -2446,6 +2474,7 @@ private:
   ChoiceOptionValue<BadOption> _badOption;
   ChoiceOptionValue<Demodulation> _backwardDemodulation;
   ChoiceOptionValue<Subsumption> _backwardSubsumption;
+  ChoiceOptionValue<BackwardSubsumptionIndex> _backwardSubsumptionIndex;
   ChoiceOptionValue<Subsumption> _backwardSubsumptionResolution;
   BoolOptionValue _backwardSubsumptionDemodulation;
   UnsignedOptionValue _backwardSubsumptionDemodulationMaxMatches;
@@ -2479,6 +2508,7 @@ private:
   UnsignedOptionValue _fmbDetectSortBoundsTimeLimit;
   UnsignedOptionValue _fmbSizeWeightRatio;
   ChoiceOptionValue<FMBEnumerationStrategy> _fmbEnumerationStrategy;
+  BoolOptionValue _fmbIncremental;
 
   BoolOptionValue _flattenTopLevelConjunctions;
   StringOptionValue _forbiddenOptions;
@@ -2487,6 +2517,7 @@ private:
   ChoiceOptionValue<Demodulation> _forwardDemodulation;
   BoolOptionValue _forwardLiteralRewriting;
   BoolOptionValue _forwardSubsumption;
+  BoolOptionValue _unprocessedVariantDeletion;
   BoolOptionValue _forwardSubsumptionResolution;
   BoolOptionValue _forwardSubsumptionDemodulation;
   UnsignedOptionValue _forwardSubsumptionDemodulationMaxMatches;
@@ -2511,6 +2542,7 @@ private:
   /** if true, then calling set() on non-existing options will not result in a user error */
   ChoiceOptionValue<IgnoreMissing> _ignoreMissing;
   StringOptionValue _include;
+  StringOptionValue _preprocessingCache;
   /** if this option is true, Vampire will add the numeral weight of a clause
    * to its weight. The weight is defined as the sum of binary sizes of all
    * integers occurring in this clause. This option has not been tested and
@@ -2560,10 +2592,15 @@ private:
 #endif
 
   UnsignedOptionValue _memoryLimit; // should be size_t, making an assumption
+  BoolOptionValue _releaseFreedMemory;
   ChoiceOptionValue<Mode> _mode;
   ChoiceOptionValue<Schedule> _schedule;
+  StringOptionValue _scheduleFile;
   UnsignedOptionValue _multicore;
   FloatOptionValue _slowness;
+  UnsignedOptionValue _sharedPreprocessing;
+  UnsignedOptionValue _lemmaExchange;
+  BoolOptionValue _adaptiveSlices;
 
   IntOptionValue _naming;
   BoolOptionValue _nonliteralsInClauseWeight;
@@ -2572,6 +2609,8 @@ private:
   BoolOptionValue _outputAxiomNames;
 
   StringOptionValue _printProofToFile;
+  StringOptionValue _checkpointFile;
+  UnsignedOptionValue _checkpointInterval;
   BoolOptionValue _printClausifierPremises;
   StringOptionValue _problemName;
   ChoiceOptionValue<Proof> _proof;
@@ -2651,12 +2690,16 @@ private:
   ChoiceOptionValue<SplittingMinimizeModel> _splittingMinimizeModel;
   ChoiceOptionValue<SplittingLiteralPolarityAdvice> _splittingLiteralPolarityAdvice;
   ChoiceOptionValue<SplittingDeleteDeactivated> _splittingDeleteDeactivated;
+  BoolOptionValue _splittingLazyIndexRemoval;
   BoolOptionValue _splittingFastRestart;
   BoolOptionValue _splittingBufferedSolver;
 
   ChoiceOptionValue<Statistics> _statistics;
   BoolOptionValue _superpositionFromVariables;
   ChoiceOptionValue<TermOrdering> _termOrdering;
+  UnsignedOptionValue _orderingCache;
+  BoolOptionValue _lazyPassive;
+  ChoiceOptionValue<IndexNodeLayout> _indexNodeLayout;
   ChoiceOptionValue<SymbolPrecedence> _symbolPrecedence;
   ChoiceOptionValue<SymbolPrecedenceBoost> _symbolPrecedenceBoost;
   ChoiceOptionValue<IntroducedSymbolPrecedence> _introducedSymbolPrecedence;
@@ -2677,6 +2720,7 @@ private:
   /** Time limit in deciseconds */
   TimeLimitOptionValue _timeLimitInDeciseconds;
   BoolOptionValue _timeStatistics;
+  BoolOptionValue _allocatorStatistics;
 
   ChoiceOptionValue<URResolution> _unitResultingResolution;
   BoolOptionValue _unusedPredicateDefinitionRemoval;
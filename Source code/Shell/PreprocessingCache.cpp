@@ -0,0 +1,251 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PreprocessingCache.cpp
+ * Implements class PreprocessingCache.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+
+#include "Lib/Environment.hpp"
+#include "Lib/Int.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Problem.hpp"
+
+#include "Parse/TPTP.hpp"
+
+#include "Options.hpp"
+#include "Property.hpp"
+#include "Statistics.hpp"
+#include "UIHelper.hpp"
+
+#include "PreprocessingCache.hpp"
+
+#define PREPROCESSING_CACHE_HEADER "% vampire preprocessing cache 1"
+
+namespace Shell
+{
+
+/**
+ * Compute the key of the problem given by the options @b opt. Caching is
+ * disabled if no cache directory is given, if the problem is read from
+ * the standard input or if one of its files cannot be read.
+ *
+ * It is also disabled when the sine levels computed during preprocessing
+ * are used later on, as they are not stored with the clauses.
+ */
+PreprocessingCache::PreprocessingCache(Options& opt)
+: _opt(opt), _hash(14695981039346656037ull)
+{
+  CALL("PreprocessingCache::PreprocessingCache");
+
+  if(opt.preprocessingCache().empty() || opt.inputFile().empty() ||
+      opt.useSineLevelSplitQueues() || opt.sineToAge() ||
+      opt.sineToPredLevels() != Options::PredicateSineLevels::OFF) {
+    return;
+  }
+  _fileName = opt.preprocessingCache();
+  hashFile(opt.inputFile());
+  if(_fileName.empty()) {
+    return;
+  }
+  vstring options = opt.generateEncodedPreprocessingOptions();
+  hash(options.c_str(), options.size());
+  // a different build may preprocess differently
+  hash(VERSION_STRING, strlen(VERSION_STRING));
+
+  char key[17];
+  snprintf(key, sizeof(key), "%016llx", _hash);
+  _fileName += "/";
+  _fileName += key;
+  _fileName += ".p";
+}
+
+/**
+ * Add the content of file @b fileName and of the files it includes to the hash.
+ *
+ * The includes are found by a textual scan for lines starting with include(
+ * and resolved as the TPTP parser resolves them.
+ */
+void PreprocessingCache::hashFile(const vstring& fileName)
+{
+  CALL("PreprocessingCache::hashFile");
+
+  if(!_hashedFiles.insert(fileName)) {
+    return;
+  }
+
+  Stack<vstring> includes;
+  {
+    BYPASSING_ALLOCATOR;
+
+    ifstream in(fileName.c_str());
+    if(in.fail()) {
+      _fileName = "";
+      return;
+    }
+    std::string line;
+    while(getline(in, line)) {
+      hash(line.c_str(), line.size());
+      hash("\n", 1);
+
+      size_t start = line.find_first_not_of(" \t");
+      if(start == std::string::npos || line.compare(start, 8, "include(") != 0) {
+        continue;
+      }
+      size_t nameStart = line.find('\'', start);
+      size_t nameEnd = nameStart == std::string::npos ? nameStart : line.find('\'', nameStart+1);
+      if(nameEnd != std::string::npos) {
+        includes.push(vstring(line.c_str()+nameStart+1, nameEnd-nameStart-1));
+      }
+    }
+  }
+
+  while(includes.isNonEmpty() && !_fileName.empty()) {
+    hashFile(_opt.includeFileName(includes.pop()));
+  }
+}
+
+void PreprocessingCache::hash(const char* data, size_t length)
+{
+  for(size_t i=0;i<length;i++) {
+    _hash ^= static_cast<unsigned char>(data[i]);
+    _hash *= 1099511628211ull;
+  }
+}
+
+/**
+ * Return the preprocessed problem stored in the cache, or 0 if there is none
+ */
+Problem* PreprocessingCache::load()
+{
+  CALL("PreprocessingCache::load");
+  ASS(enabled());
+
+  istream* input;
+  {
+    BYPASSING_ALLOCATOR;
+
+    input = new ifstream(_fileName.c_str());
+  }
+  vstring header, conjecture, incomplete;
+  if(input->fail() || !getline(*input, header) || header != PREPROCESSING_CACHE_HEADER ||
+      !getline(*input, conjecture) || !getline(*input, incomplete)) {
+    BYPASSING_ALLOCATOR;
+
+    delete static_cast<ifstream*>(input);
+    return 0;
+  }
+
+  Parse::TPTP parser(*input);
+  parser.parse();
+  {
+    BYPASSING_ALLOCATOR;
+
+    delete static_cast<ifstream*>(input);
+  }
+
+  UIHelper::setConjecturePresence(conjecture == "% conjecture 1");
+  Problem* res = new Problem(parser.units());
+  if(incomplete == "% incomplete 1") {
+    res->reportIncompleteTransformation();
+  }
+  return res;
+}
+
+/**
+ * Store the preprocessed problem @b prb in the cache, unless it contains
+ * something that cannot be restored by parsing cnf() units
+ *
+ * The problem is first written into a temporary file which is then renamed,
+ * so that runs loading the problem at the same time never see a partial file.
+ */
+void PreprocessingCache::store(Problem& prb)
+{
+  CALL("PreprocessingCache::store");
+  ASS(enabled());
+
+  if(!canStore(prb)) {
+    return;
+  }
+
+  vstring tmpName = _fileName + ".tmp" + Int::toString(getpid());
+  BYPASSING_ALLOCATOR;
+
+  ofstream out(tmpName.c_str());
+  if(out.fail()) {
+    return;
+  }
+  out << PREPROCESSING_CACHE_HEADER << endl;
+  out << "% conjecture " << UIHelper::haveConjecture() << endl;
+  out << "% incomplete " << prb.hadIncompleteTransformation() << endl;
+
+  UnitList::Iterator uit(prb.units());
+  while(uit.hasNext()) {
+    Clause* cl = uit.next()->asClause();
+    out << "cnf(u" << cl->number() << ", " << role(cl) << ", ";
+    if(cl->isEmpty()) {
+      out << "$false";
+    }
+    for(unsigned i=0;i<cl->length();i++) {
+      if(i) {
+        out << " | ";
+      }
+      out << (*cl)[i]->toString();
+    }
+    out << ")." << endl;
+  }
+  out.close();
+  if(out.fail() || rename(tmpName.c_str(), _fileName.c_str())) {
+    remove(tmpName.c_str());
+  }
+}
+
+bool PreprocessingCache::canStore(Problem& prb)
+{
+  CALL("PreprocessingCache::canStore");
+
+  if(prb.hasFormulas() || prb.hasInterpretedOperations() || prb.hasNumerals() ||
+      prb.hasFOOL() || prb.higherOrder() || prb.hasPolymorphicSym() ||
+      prb.getProperty()->hasNonDefaultSorts()) {
+    return false;
+  }
+  UnitList::Iterator uit(prb.units());
+  while(uit.hasNext()) {
+    if(!role(uit.next()->asClause())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Return the TPTP role restoring the input type of @b cl, or 0 if there is none */
+const char* PreprocessingCache::role(Clause* cl)
+{
+  switch(cl->inputType()) {
+  case UnitInputType::AXIOM:
+    return "axiom";
+  case UnitInputType::CONJECTURE:
+  case UnitInputType::NEGATED_CONJECTURE:
+    return "negated_conjecture";
+  case UnitInputType::ASSUMPTION:
+    return "hypothesis";
+  case UnitInputType::CLAIM:
+    return "claim";
+  default:
+    return 0;
+  }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file PreprocessingCache.hpp
+ * Defines class PreprocessingCache.
+ */
+
+#ifndef __PreprocessingCache__
+#define __PreprocessingCache__
+
+#include "Forwards.hpp"
+
+#include "Lib/DHSet.hpp"
+#include "Lib/Stack.hpp"
+
+namespace Shell {
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * On-disk cache of preprocessed problems, stored in the directory given by
+ * the preprocessing_cache option.
+ *
+ * A problem is cached under a key consisting of a hash of the input file,
+ * of the files it includes, of the options relevant to preprocessing
+ * (see Options::generateEncodedPreprocessingOptions()) and of the version
+ * of Vampire. A cached problem is stored as a list of cnf() units in TPTP,
+ * so that loading it only parses the clauses that preprocessing kept and
+ * skips the preprocessing.
+ *
+ * Only problems that consist of first-order clauses without sorts and
+ * interpreted symbols are cached, since parsing cnf() restores all
+ * information needed to saturate such problems.
+ */
+class PreprocessingCache
+{
+public:
+  CLASS_NAME(PreprocessingCache);
+  USE_ALLOCATOR(PreprocessingCache);
+
+  explicit PreprocessingCache(Options& opt);
+
+  /** Return true if problems can be cached with the current input and options */
+  bool enabled() const { return !_fileName.empty(); }
+
+  Problem* load();
+  void store(Problem& prb);
+
+private:
+  void hashFile(const vstring& fileName);
+  void hash(const char* data, size_t length);
+
+  static bool canStore(Problem& prb);
+  static const char* role(Clause* cl);
+
+  Options& _opt;
+  /** The file storing the problem, or empty if caching is disabled */
+  vstring _fileName;
+  /** 64-bit FNV-1a hash of the input files and options */
+  unsigned long long _hash;
+  /** Files already hashed, so that repeated includes are hashed once */
+  DHSet<vstring> _hashedFiles;
+};
+
+}
+
+#endif // __PreprocessingCache__
@@ -43,6 +43,8 @@ using namespace Shell;
 Statistics::Statistics()
   : inputClauses(0),
     inputFormulas(0),
+    inputBytes(0),
+    parsingTime(0),
     formulaNames(0),
     initialClauses(0),
     splitInequalities(0),
@@ -140,7 +142,10 @@ Statistics::Statistics()
     simpleTautologies(0),
     equationalTautologies(0),
     forwardSubsumed(0),
+    unprocessedVariants(0),
     backwardSubsumed(0),
+    subsumptionFeatureChecks(0),
+    subsumptionFeatureRejections(0),
     taDistinctnessSimplifications(0),
     taDistinctnessTautologyDeletions(0),
     taInjectivitySimplifications(0),
@@ -148,8 +153,15 @@ Statistics::Statistics()
     taAcyclicityGeneratedDisequalities(0),
     generatedClauses(0),
     passiveClauses(0),
+    deferredClauses(0),
+    materializedClauses(0),
     activeClauses(0),
     extensionalityClauses(0),
+    exportedLemmas(0),
+    importedLemmas(0),
+    checkpoints(0),
+    orderingCacheHits(0),
+    orderingCacheMisses(0),
     discardedNonRedundantClauses(0),
     inferencesBlockedForOrderingAftercheck(0),
     smtReturnedUnknown(false),
@@ -167,6 +179,8 @@ Statistics::Statistics()
 
     satSplits(0),
     satSplitRefutations(0),
+    suspendedIndexRemovals(0),
+    resumedIndexEntries(0),
 
     smtFallbacks(0),
 
@@ -270,9 +284,12 @@ void Statistics::print(ostream& out)
 
   if (env.options->statistics()==Options::Statistics::FULL) {
 
-  HEADING("Input",inputClauses+inputFormulas);
+  HEADING("Input",inputClauses+inputFormulas+inputBytes);
   COND_OUT("Input clauses", inputClauses);
   COND_OUT("Input formulas", inputFormulas);
+  COND_OUT("Input bytes parsed", inputBytes);
+  // bytes per millisecond / 1000 = MB per second
+  COND_OUT("Parsing throughput (MB/s)", parsingTime ? inputBytes/(1000.0*parsingTime) : 0);
 
   HEADING("Preprocessing",formulaNames+purePredicates+trivialPredicates+
     unusedPredicateDefinitions+functionDefinitions+selectedBySine+
@@ -290,13 +307,16 @@ void Statistics::print(ostream& out)
   COND_OUT("Split inequalities", splitInequalities);
   SEPARATOR;
 
-  HEADING("Saturation",activeClauses+passiveClauses+extensionalityClauses+
+  HEADING("Saturation",activeClauses+passiveClauses+deferredClauses+materializedClauses+extensionalityClauses+
       generatedClauses+finalActiveClauses+finalPassiveClauses+finalExtensionalityClauses+
-      discardedNonRedundantClauses+inferencesSkippedDueToColors+inferencesBlockedForOrderingAftercheck);
+      discardedNonRedundantClauses+inferencesSkippedDueToColors+inferencesBlockedForOrderingAftercheck+
+      exportedLemmas+importedLemmas+checkpoints+orderingCacheHits+orderingCacheMisses);
   COND_OUT("Initial clauses", initialClauses);
   COND_OUT("Generated clauses", generatedClauses);
   COND_OUT("Active clauses", activeClauses);
   COND_OUT("Passive clauses", passiveClauses);
+  COND_OUT("Deferred clauses", deferredClauses);
+  COND_OUT("Materialized clauses", materializedClauses);
   COND_OUT("Extensionality clauses", extensionalityClauses);
   COND_OUT("Blocked clauses", blockedClauses);
   COND_OUT("Final active clauses", finalActiveClauses);
@@ -305,6 +325,11 @@ void Statistics::print(ostream& out)
   COND_OUT("Discarded non-redundant clauses", discardedNonRedundantClauses);
   COND_OUT("Inferences skipped due to colors", inferencesSkippedDueToColors);
   COND_OUT("Inferences blocked due to ordering aftercheck", inferencesBlockedForOrderingAftercheck);
+  COND_OUT("Exported lemmas", exportedLemmas);
+  COND_OUT("Imported lemmas", importedLemmas);
+  COND_OUT("Checkpoints", checkpoints);
+  COND_OUT("Ordering cache hits", orderingCacheHits);
+  COND_OUT("Ordering cache misses", orderingCacheMisses);
   SEPARATOR;
 
 
@@ -348,14 +373,17 @@ void Statistics::print(ostream& out)
   SEPARATOR;
 
   HEADING("Deletion Inferences",simpleTautologies+equationalTautologies+
-      forwardSubsumed+backwardSubsumed+forwardDemodulationsToEqTaut+
+      forwardSubsumed+unprocessedVariants+backwardSubsumed+subsumptionFeatureChecks+forwardDemodulationsToEqTaut+
       forwardSubsumptionDemodulationsToEqTaut+backwardSubsumptionDemodulationsToEqTaut+
       backwardDemodulationsToEqTaut+innerRewritesToEqTaut);
   COND_OUT("Simple tautologies", simpleTautologies);
   COND_OUT("Equational tautologies", equationalTautologies);
   COND_OUT("Deep equational tautologies", deepEquationalTautologies);
   COND_OUT("Forward subsumptions", forwardSubsumed);
+  COND_OUT("Unprocessed variants", unprocessedVariants);
   COND_OUT("Backward subsumptions", backwardSubsumed);
+  COND_OUT("Subsumption feature checks", subsumptionFeatureChecks);
+  COND_OUT("Subsumption feature rejections", subsumptionFeatureRejections);
   COND_OUT("Fw demodulations to eq. taut.", forwardDemodulationsToEqTaut);
   COND_OUT("Bw demodulations to eq. taut.", backwardDemodulationsToEqTaut);
   COND_OUT("Fw subsumption demodulations to eq. taut.", forwardSubsumptionDemodulationsToEqTaut);
@@ -435,12 +463,14 @@ void Statistics::print(ostream& out)
   COND_OUT("Disequalities generated from acyclicity",taAcyclicityGeneratedDisequalities);
 
   HEADING("AVATAR",splitClauses+splitComponents+uniqueComponents+satSplits+
-        satSplitRefutations);
+        satSplitRefutations+suspendedIndexRemovals);
   COND_OUT("Split clauses", splitClauses);
   COND_OUT("Split components", splitComponents);
   COND_OUT("Unique components", uniqueComponents);
   //COND_OUT("Sat splits", satSplits); // same as split clauses
   COND_OUT("Sat splitting refutations", satSplitRefutations);
+  COND_OUT("Suspended index removals", suspendedIndexRemovals);
+  COND_OUT("Reused index entries", resumedIndexEntries);
   COND_OUT("SMT fallbacks",smtFallbacks);
   SEPARATOR;
 
@@ -491,6 +521,9 @@ void Statistics::print(ostream& out)
   if (env.options && env.options->timeStatistics()) {
     TimeCounter::printReport(out);
   }
+  if (env.options && env.options->allocatorStatistics()) {
+    Allocator::reportUsageBySizeClasses(out);
+  }
 }
 
 const char* Statistics::phaseToString(ExecutionPhase p)
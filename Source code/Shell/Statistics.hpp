@@ -58,6 +58,10 @@ public:
   unsigned inputClauses;
   /** number of input formulas */
   unsigned inputFormulas;
+  /** number of characters read by the TPTP parser */
+  size_t inputBytes;
+  /** time spent in the TPTP parser in milliseconds */
+  unsigned parsingTime;
 
   // Preprocessing
   /** number of formula names introduced during preprocessing */
@@ -230,8 +234,14 @@ public:
   unsigned equationalTautologies;
   /** number of forward subsumed clauses */
   unsigned forwardSubsumed;
+  /** clauses deleted as variants of clauses retained from the same unprocessed batch */
+  unsigned unprocessedVariants;
   /** number of backward subsumed clauses */
   unsigned backwardSubsumed;
+  /** clause pairs whose feature vectors were compared before matching them for subsumption */
+  unsigned subsumptionFeatureChecks;
+  /** clause pairs not matched because their feature vectors exclude subsumption */
+  unsigned subsumptionFeatureRejections;
 
   /** statistics of term algebra rules */
   unsigned taDistinctnessSimplifications;
@@ -245,10 +255,24 @@ public:
   unsigned generatedClauses;
   /** all passive clauses */
   unsigned passiveClauses;
+  /** generated clauses whose literals were built only on selection */
+  unsigned deferredClauses;
+  /** deferred clauses that were selected and had their literals built */
+  unsigned materializedClauses;
   /** all active clauses */
   unsigned activeClauses;
   /** all extensionality clauses */
   unsigned extensionalityClauses;
+  /** clauses published for the other strategies of a portfolio run */
+  unsigned exportedLemmas;
+  /** clauses received from the other strategies of a portfolio run */
+  unsigned importedLemmas;
+  /** checkpoints of the active and passive clauses written */
+  unsigned checkpoints;
+  /** term comparisons answered from the ordering cache */
+  unsigned orderingCacheHits;
+  /** term comparisons looked up in the ordering cache but not found */
+  unsigned orderingCacheMisses;
 
   unsigned discardedNonRedundantClauses;
 
@@ -279,6 +303,10 @@ public:
 
   unsigned satSplits;
   unsigned satSplitRefutations;
+  /** Number of index removals postponed because of AVATAR deactivation */
+  unsigned suspendedIndexRemovals;
+  /** Number of reactivated clauses that reused their suspended index entries */
+  unsigned resumedIndexEntries;
 
   unsigned smtFallbacks;
 
@@ -22,6 +22,7 @@
 #include "Forwards.hpp"
 
 #include "Lib/Environment.hpp"
+#include "Lib/mmapstream.hpp"
 #include "Lib/TimeCounter.hpp"
 #include "Lib/VString.hpp"
 #include "Lib/Timer.hpp"
@@ -33,6 +34,8 @@
 #include "Parse/SMTLIB2.hpp"
 #include "Parse/TPTP.hpp"
 
+#include "Saturation/Checkpoint.hpp"
+
 #include "AnswerExtractor.hpp"
 #include "InterpolantMinimizer.hpp"
 #include "InterpolantMinimizerNew.hpp"
@@ -233,8 +236,8 @@ void resetParsing(T exception, vstring inputFile, istream*& input,vstring nowtry
   }
 
   BYPASSING_ALLOCATOR;
-  delete static_cast<ifstream*>(input);
-  input=new ifstream(inputFile.c_str());
+  delete input;
+  input=mmapstream::openInputFile(inputFile.c_str());
 }
 
 /**
@@ -261,7 +264,7 @@ Problem* UIHelper::getInputProblem(const Options& opts)
     // CAREFUL: this might not be enough if the ifstream (re)allocates while being operated
     BYPASSING_ALLOCATOR; 
     
-    input=new ifstream(inputFile.c_str());
+    input=mmapstream::openInputFile(inputFile.c_str());
     if (input->fail()) {
       USER_ERROR("Cannot open problem file: "+inputFile);
     }
@@ -326,7 +329,7 @@ Problem* UIHelper::getInputProblem(const Options& opts)
   if (inputFile!="") {
     BYPASSING_ALLOCATOR;
     
-    delete static_cast<ifstream*>(input);
+    delete input;
     input=0;
   }
 
@@ -334,6 +337,9 @@ Problem* UIHelper::getInputProblem(const Options& opts)
 
   Problem* res = new Problem(units);
   res->setSMTLIBLogic(smtLibLogic);
+  if (inputFile!="" && Saturation::Checkpoint::isIncomplete(inputFile)) {
+    res->reportIncompleteTransformation();
+  }
 
   env.statistics->phase=Statistics::UNKNOWN_PHASE;
   return res;
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file tBackwardSubsumption.cpp
+ * Checks that the backward subsumption engines agree with each other.
+ */
+
+#include <algorithm>
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "Indexing/FeatureVectorIndex.hpp"
+#include "Indexing/LiteralIndex.hpp"
+#include "Indexing/LiteralSubstitutionTree.hpp"
+
+#include "Inferences/FeatureVectorBackwardSubsumption.hpp"
+#include "Inferences/SLQueryBackwardSubsumption.hpp"
+
+#include "Saturation/ClauseContainer.hpp"
+
+using namespace Indexing;
+using namespace Inferences;
+using namespace Saturation;
+
+Stack<Clause*> subsumedBy(BackwardSimplificationEngine& bs, Clause* cl)
+{
+  BwSimplificationRecordIterator it;
+  bs.perform(cl, it);
+  Stack<Clause*> res;
+  while(it.hasNext()) {
+    res.push(it.next().toRemove);
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+TEST_FUN(feature_vector_agrees_with_slquery)
+{
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_FUNC(f, {s}, s)
+  DECL_FUNC(g, {s}, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+  DECL_PRED(r, {s})
+
+  SimplifyingLiteralIndex* litIndex = new SimplifyingLiteralIndex(new LiteralSubstitutionTree());
+  FeatureVectorIndex* fvIndex = new FeatureVectorIndex();
+  PlainClauseContainer container;
+  litIndex->attachContainer(&container);
+  fvIndex->attachContainer(&container);
+
+  Stack<Clause*> context = clauses({
+      { p(f(a)), q(a) },
+      { p(f(x)), q(x), r(x) },
+      { ~p(a), q(b) },
+      { p(g(a)), q(f(b)), ~r(a) },
+      { f(a) == b, p(b) },
+      { p(x), p(y) },
+      { q(a) },
+      { r(a), ~p(a), q(b) },
+      { p(f(a)), p(f(b)), q(a) },
+  });
+  Stack<Clause*>::Iterator cit(context);
+  while(cit.hasNext()) {
+    Clause* c = cit.next();
+    c->setStore(Clause::ACTIVE);
+    container.add(c);
+  }
+
+  SLQueryBackwardSubsumption slquery(litIndex);
+  FeatureVectorBackwardSubsumption featureVector(fvIndex, litIndex);
+
+  Stack<Clause*> queries = clauses({
+      { },
+      { p(x) },
+      { q(a) },
+      { p(f(x)), q(x) },
+      { ~p(x), q(y) },
+      { p(x), q(y) },
+      { f(x) == y, p(y) },
+      { p(x), p(y) },
+      { p(f(x)), p(f(y)), q(a) },
+      { r(x), q(y), ~p(z) },
+  });
+  Stack<Clause*>::Iterator qit(queries);
+  while(qit.hasNext()) {
+    Clause* query = qit.next();
+    Stack<Clause*> expected = subsumedBy(slquery, query);
+    Stack<Clause*> result = subsumedBy(featureVector, query);
+    ASS_EQ(expected, result);
+    ASS(expected.isNonEmpty());
+  }
+
+  delete fvIndex;
+  delete litIndex;
+}
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file tClauseBucketQueue.cpp
+ * Tests of the age/weight bucket queue of passive clauses.
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "Kernel/ClauseBucketQueue.hpp"
+
+#include "Shell/Options.hpp"
+
+using namespace Kernel;
+
+#define MY_SYNTAX_SUGAR                                                                                       \
+  DECL_SORT(s)                                                                                                \
+  DECL_CONST(a, s)                                                                                            \
+  DECL_FUNC(f, {s}, s)                                                                                        \
+  DECL_PRED(p, {s})                                                                                           \
+
+/**
+ * Clauses with the ages and weights
+ *   cls[0]: age 0, weight 4
+ *   cls[1]: age 2, weight 2
+ *   cls[2]: age 1, weight 3
+ *   cls[3]: age 1, weight 2
+ *   cls[4]: age 1, weight 2, a negated conjecture
+ */
+Stack<Clause*> makeClauses(const Shell::Options& opt)
+{
+  MY_SYNTAX_SUGAR
+
+  Stack<Clause*> cls = clauses({
+      { p(f(f(a))) },
+      { p(a) },
+      { p(f(a)) },
+      { p(a) },
+      { p(a) },
+  });
+  unsigned ages[] = { 0, 2, 1, 1, 1 };
+  for (unsigned i=0; i<cls.size(); i++) {
+    cls[i]->setAge(ages[i]);
+  }
+  cls[4]->setInputType(UnitInputType::NEGATED_CONJECTURE);
+
+  ASS_L(cls[1]->weightForClauseSelection(opt), cls[2]->weightForClauseSelection(opt));
+  ASS_L(cls[2]->weightForClauseSelection(opt), cls[0]->weightForClauseSelection(opt));
+  ASS_EQ(cls[1]->weightForClauseSelection(opt), cls[4]->weightForClauseSelection(opt));
+  return cls;
+}
+
+void insertAll(ClauseBucketQueue& queue, const Stack<Clause*>& cls)
+{
+  for (unsigned i=0; i<cls.size(); i++) {
+    queue.insert(cls[i]);
+  }
+  ASS_EQ(queue.size(), cls.size());
+}
+
+TEST_FUN(pop_by_age)
+{
+  Shell::Options opt;
+  Stack<Clause*> cls = makeClauses(opt);
+  ClauseBucketQueue queue(opt);
+  insertAll(queue, cls);
+
+  // by age, then weight, then the negated conjecture before the older assumption
+  unsigned expected[] = { 0, 4, 3, 2, 1 };
+  for (unsigned i : expected) {
+    ASS_EQ(queue.popByAge(), cls[i]);
+  }
+  ASS(queue.isEmpty());
+}
+
+TEST_FUN(pop_by_weight)
+{
+  Shell::Options opt;
+  Stack<Clause*> cls = makeClauses(opt);
+  ClauseBucketQueue queue(opt);
+  insertAll(queue, cls);
+
+  // by weight, then age, then the negated conjecture before the older assumption
+  unsigned expected[] = { 4, 3, 1, 2, 0 };
+  for (unsigned i : expected) {
+    ASS_EQ(queue.popByWeight(), cls[i]);
+  }
+  ASS(queue.isEmpty());
+}
+
+TEST_FUN(pop_interleaved)
+{
+  Shell::Options opt;
+  Stack<Clause*> cls = makeClauses(opt);
+  ClauseBucketQueue queue(opt);
+  insertAll(queue, cls);
+
+  ASS_EQ(queue.popByWeight(), cls[4]);
+  ASS_EQ(queue.popByAge(), cls[0]);
+  ASS_EQ(queue.popByWeight(), cls[3]);
+  ASS_EQ(queue.popByAge(), cls[2]);
+
+  // reinserting into the released buckets and rows
+  queue.insert(cls[0]);
+  queue.insert(cls[4]);
+  ASS_EQ(queue.popByAge(), cls[0]);
+  ASS_EQ(queue.popByWeight(), cls[4]);
+  ASS_EQ(queue.popByWeight(), cls[1]);
+  ASS(queue.isEmpty());
+}
+
+TEST_FUN(remove)
+{
+  Shell::Options opt;
+  Stack<Clause*> cls = makeClauses(opt);
+  ClauseBucketQueue queue(opt);
+  insertAll(queue, cls);
+
+  ASS(queue.remove(cls[3]));
+  ASS(!queue.remove(cls[3]));
+  ASS(queue.remove(cls[0]));
+  ASS_EQ(queue.size(), 3);
+
+  ASS_EQ(queue.popByAge(), cls[4]);
+  ASS_EQ(queue.popByAge(), cls[2]);
+  ASS_EQ(queue.popByAge(), cls[1]);
+  ASS(queue.isEmpty());
+}
+
+TEST_FUN(remove_while_iterating)
+{
+  Shell::Options opt;
+  Stack<Clause*> cls = makeClauses(opt);
+  ClauseBucketQueue queue(opt);
+  insertAll(queue, cls);
+
+  // removing the clause just returned, which empties some buckets and rows
+  unsigned expectedAge[] = { 0, 4, 3, 2, 1 };
+  unsigned cnt = 0;
+  ClauseBucketQueue::AgeIterator ait(queue);
+  while (ait.hasNext()) {
+    Clause* cl = ait.next();
+    ASS_EQ(cl, cls[expectedAge[cnt++]]);
+    ASS(queue.remove(cl));
+  }
+  ASS_EQ(cnt, 5);
+  ASS(queue.isEmpty());
+
+  // removing a clause not yet reached skips it
+  insertAll(queue, cls);
+  unsigned expectedWeight[] = { 4, 1, 2, 0 };
+  cnt = 0;
+  ClauseBucketQueue::WeightIterator wit(queue);
+  while (wit.hasNext()) {
+    Clause* cl = wit.next();
+    ASS_EQ(cl, cls[expectedWeight[cnt++]]);
+    if (cl == cls[4]) {
+      ASS(queue.remove(cls[3]));
+    }
+  }
+  ASS_EQ(cnt, 4);
+  ASS_EQ(queue.size(), 4);
+}
@@ -0,0 +1,169 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file tIndexSuspension.cpp
+ * Tests of the index entries kept for clauses deactivated by an AVATAR
+ * backtrack, see Index::s_suspendRemovals.
+ */
+
+#include <algorithm>
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "Lib/Environment.hpp"
+#include "Lib/ScopedLet.hpp"
+
+#include "Indexing/LiteralIndex.hpp"
+#include "Indexing/LiteralSubstitutionTree.hpp"
+
+#include "Saturation/ClauseContainer.hpp"
+
+#include "Shell/Statistics.hpp"
+
+using namespace Indexing;
+using namespace Saturation;
+
+#define MY_SYNTAX_SUGAR                                                                                       \
+  DECL_DEFAULT_VARS                                                                                           \
+  DECL_SORT(s)                                                                                                \
+  DECL_CONST(a, s)                                                                                            \
+  DECL_CONST(b, s)                                                                                            \
+  DECL_PRED(p, {s})                                                                                           \
+  DECL_PRED(q, {s})                                                                                           \
+
+Stack<Clause*> unifying(LiteralIndex& index, Literal* lit)
+{
+  Stack<Clause*> res;
+  SLQueryResultIterator it = index.getUnifications(lit, false, false);
+  while(it.hasNext()) {
+    res.push(it.next().clause);
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+Stack<Clause*> sorted(Stack<Clause*> cls)
+{
+  std::sort(cls.begin(), cls.end());
+  return cls;
+}
+
+void add(ClauseContainer& container, Clause* c)
+{
+  c->setStore(Clause::ACTIVE);
+  container.add(c);
+}
+
+/** Remove @b c from @b container the way Splitter::removeComponents does it on a backtrack */
+void backtrack(ClauseContainer& container, Clause* c)
+{
+  ScopedLet<bool> suspendLet(Index::s_suspendRemovals, true);
+  container.removedEvent.fire(c);
+}
+
+TEST_FUN(suspend_and_resume)
+{
+  MY_SYNTAX_SUGAR
+
+  PlainClauseContainer container;
+  SimplifyingLiteralIndex index(new LiteralSubstitutionTree());
+  index.attachContainer(&container);
+
+  Clause* c1 = clause({ p(a), q(b) });
+  Clause* c2 = clause({ p(x) });
+  add(container, c1);
+  add(container, c2);
+  ASS_EQ(unifying(index, p(y)), sorted({ c1, c2 }));
+
+  unsigned suspended = env.statistics->suspendedIndexRemovals;
+  backtrack(container, c1);
+  ASS_EQ(env.statistics->suspendedIndexRemovals, suspended + 1);
+  ASS_EQ(unifying(index, p(y)), sorted({ c2 }));
+  ASS(unifying(index, q(y)).isEmpty());
+
+  // the clause comes back after the next model change
+  unsigned resumed = env.statistics->resumedIndexEntries;
+  add(container, c1);
+  ASS_EQ(env.statistics->resumedIndexEntries, resumed + 1);
+  ASS_EQ(unifying(index, p(y)), sorted({ c1, c2 }));
+  ASS_EQ(unifying(index, q(y)), sorted({ c1 }));
+
+  // removals outside of a backtrack are immediate
+  container.removedEvent.fire(c1);
+  ASS_EQ(env.statistics->suspendedIndexRemovals, suspended + 1);
+  ASS_EQ(unifying(index, p(y)), sorted({ c2 }));
+  ASS(unifying(index, q(y)).isEmpty());
+}
+
+TEST_FUN(resume_with_different_selection)
+{
+  MY_SYNTAX_SUGAR
+
+  PlainClauseContainer container;
+  GeneratingLiteralIndex index(new LiteralSubstitutionTree());
+  index.attachContainer(&container);
+
+  Clause* c = clause({ p(a), q(b) });
+  c->setSelected(1);
+  add(container, c);
+  ASS_EQ(unifying(index, p(y)), sorted({ c }));
+  ASS(unifying(index, q(y)).isEmpty());
+
+  backtrack(container, c);
+  ASS(unifying(index, p(y)).isEmpty());
+
+  // the clause comes back with the other literal selected
+  (*c)[0] = q(b);
+  (*c)[1] = p(a);
+  c->setSelected(1);
+  unsigned resumed = env.statistics->resumedIndexEntries;
+  add(container, c);
+  ASS_EQ(env.statistics->resumedIndexEntries, resumed);
+  ASS(unifying(index, p(y)).isEmpty());
+  ASS_EQ(unifying(index, q(y)), sorted({ c }));
+
+  container.removedEvent.fire(c);
+  ASS(unifying(index, q(y)).isEmpty());
+}
+
+TEST_FUN(purge_suspended)
+{
+  MY_SYNTAX_SUGAR
+
+  PlainClauseContainer container;
+  SimplifyingLiteralIndex index(new LiteralSubstitutionTree());
+  index.attachContainer(&container);
+
+  Stack<Clause*> cls;
+  for(unsigned i=0; i<100; i++) {
+    Clause* c = clause({ p(x) });
+    add(container, c);
+    cls.push(c);
+  }
+
+  // the 65th suspension removes the entries of all suspended clauses
+  for(unsigned i=0; i<70; i++) {
+    backtrack(container, cls[i]);
+  }
+  ASS_EQ(unifying(index, p(a)).size(), 30);
+
+  unsigned resumed = env.statistics->resumedIndexEntries;
+  for(unsigned i=0; i<70; i++) {
+    add(container, cls[i]);
+  }
+  ASS_EQ(env.statistics->resumedIndexEntries, resumed + 5);
+  ASS_EQ(unifying(index, p(a)), sorted(cls));
+
+  for(unsigned i=0; i<100; i++) {
+    container.removedEvent.fire(cls[i]);
+  }
+  ASS(unifying(index, p(a)).isEmpty());
+}
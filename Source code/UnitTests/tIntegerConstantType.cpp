@@ -9,11 +9,13 @@
  */
 #include <iostream>
 #include "Lib/List.hpp"
+#include "Kernel/Theory.hpp"
 
 #include "Test/UnitTesting.hpp"
 
 using namespace std;
 using namespace Lib;
+using namespace Kernel;
 
 TEST_FUN(list_1)
 {
@@ -29,3 +31,160 @@ TEST_FUN(list_1)
   ASS_EQ(lst->head(), 0);
   ASS_ALLOC_TYPE(lst, "List");
 }
+
+/////////////////////////////////////////////// IntegerConstantType ///////////////////////////////////////////////
+
+#define INT_MAX_PLUS_1 "2147483648"
+
+TEST_FUN(parse_print)
+{
+  for (auto s : { "0", "-7", "2147483647", "-2147483648", INT_MAX_PLUS_1, "-2147483649",
+                  "4294967296", "18446744073709551616", "-123456789012345678901234567890",
+                  "1000000000000000000000000000001" }) {
+    ASS_EQ(IntegerConstantType(vstring(s)).toString(), s)
+  }
+  ASS_EQ(IntegerConstantType(vstring("-00012345678901234567890")).toString(), "-12345678901234567890")
+}
+
+TEST_FUN(small_representation)
+{
+  IntegerConstantType max = std::numeric_limits<int>::max();
+  IntegerConstantType min = std::numeric_limits<int>::min();
+
+  ASS(max.fitsInner())
+  ASS(!(max + 1).fitsInner())
+  ASS((max + 1 - 1).fitsInner())
+  ASS_EQ(max + 1 - 1, max)
+  ASS(!(-min).fitsInner())
+  ASS((-(-min)).fitsInner())
+  ASS_EQ(-(-min), min)
+  ASS(!(min - 1).fitsInner())
+  ASS_EQ(IntegerConstantType(vstring("-2147483648")), min)
+  ASS(IntegerConstantType(vstring("-2147483648")).fitsInner())
+}
+
+TEST_FUN(overflow_arithmetic)
+{
+  IntegerConstantType max = std::numeric_limits<int>::max();
+  IntegerConstantType min = std::numeric_limits<int>::min();
+
+  ASS_EQ(max + 1, IntegerConstantType(vstring(INT_MAX_PLUS_1)))
+  ASS_EQ(-min, IntegerConstantType(vstring(INT_MAX_PLUS_1)))
+  ASS_EQ(min.abs(), IntegerConstantType(vstring(INT_MAX_PLUS_1)))
+  ASS_EQ(min - max, IntegerConstantType(vstring("-4294967295")))
+  ASS_EQ(min * min, IntegerConstantType(vstring("4611686018427387904")))
+  ASS_EQ(min * max, IntegerConstantType(vstring("-4611686016279904256")))
+
+  IntegerConstantType big(vstring("123456789012345678901234567890"));
+  ASS_EQ(big * big, IntegerConstantType(vstring("15241578753238836750495351562536198787501905199875019052100")))
+  ASS_EQ(big - big, 0)
+  ASS_EQ(big + (-big), 0)
+  ASS_EQ((big * big).intDivide(big), big)
+  ASS_EQ((big * 7).intDivide(7), big)
+}
+
+TEST_FUN(overflow_comparison)
+{
+  IntegerConstantType max = std::numeric_limits<int>::max();
+  IntegerConstantType min = std::numeric_limits<int>::min();
+  IntegerConstantType big(vstring("18446744073709551616"));
+
+  ASS(max < max + 1)
+  ASS(min - 1 < min)
+  ASS(-big < min - 1)
+  ASS(-big < 0)
+  ASS(big > max + 1)
+  ASS(big + 1 > big)
+  ASS(-big > -big - 1)
+  ASS(big != -big)
+  ASS_EQ(IntegerConstantType::comparePrecedence(-big, big), GREATER)
+  ASS_EQ(IntegerConstantType::comparePrecedence(big, 7), GREATER)
+  ASS_EQ(IntegerConstantType::comparePrecedence(min, max), GREATER)
+  ASS_EQ((max + 1).hash(), (-min).hash())
+}
+
+void checkDivision(IntegerConstantType i, IntegerConstantType j)
+{
+  auto q = i.quotientE(j);
+  auto r = i.remainderE(j);
+  ASS_EQ(q * j + r, i)
+  ASS(IntegerConstantType(0) <= r && r < j.abs())
+
+  auto qt = i.quotientT(j);
+  auto rt = i.remainderT(j);
+  ASS_EQ(qt * j + rt, i)
+  ASS(rt.abs() < j.abs())
+  ASS(rt.isZero() || rt.isNegative() == i.isNegative())
+
+  auto qf = i.quotientF(j);
+  auto rf = i.remainderF(j);
+  ASS_EQ(qf * j + rf, i)
+  ASS(rf.abs() < j.abs())
+  ASS(rf.isZero() || rf.isNegative() == j.isNegative())
+}
+
+TEST_FUN(overflow_division)
+{
+  IntegerConstantType min = std::numeric_limits<int>::min();
+  Stack<IntegerConstantType> nums;
+  for (auto s : { "1", "3", "7", "2147483647", INT_MAX_PLUS_1, "4294967296", "4294967297",
+                  "18446744073709551617", "123456789012345678901234567890" }) {
+    nums.push(IntegerConstantType(vstring(s)));
+    nums.push(-IntegerConstantType(vstring(s)));
+  }
+  nums.push(min);
+  nums.push(0);
+  for (unsigned i = 0; i < nums.size(); i++) {
+    for (unsigned j = 0; j < nums.size(); j++) {
+      if (!nums[j].isZero()) {
+        checkDivision(nums[i], nums[j]);
+      }
+    }
+  }
+
+  ASS_EQ(min.quotientE(-1), IntegerConstantType(vstring(INT_MAX_PLUS_1)))
+  ASS_EQ(min.remainderE(-1), 0)
+  ASS(IntegerConstantType(-1).divides(min))
+  ASS(IntegerConstantType(vstring("4294967296")).divides(IntegerConstantType(vstring("18446744073709551616"))))
+  ASS(!IntegerConstantType(vstring("4294967297")).divides(IntegerConstantType(vstring("18446744073709551616"))))
+}
+
+TEST_FUN(overflow_rationals)
+{
+  IntegerConstantType big(vstring("123456789012345678901234567890"));
+  IntegerConstantType min = std::numeric_limits<int>::min();
+
+  ASS_EQ(RationalConstantType(big * 6, big * 4), RationalConstantType(3, 2))
+  ASS_EQ(RationalConstantType(min, min), RationalConstantType(1))
+  ASS_EQ(RationalConstantType(1, min).denominator(), IntegerConstantType(vstring(INT_MAX_PLUS_1)))
+  ASS_EQ(RationalConstantType(1, big) * RationalConstantType(big, 1), RationalConstantType(1))
+  ASS_EQ(RationalConstantType(1, big) + RationalConstantType(1, big), RationalConstantType(2, big))
+
+  ASS(RationalConstantType(big, big + 1) < RationalConstantType(1))
+  ASS(RationalConstantType(big + 1, big) > RationalConstantType(1))
+  ASS(RationalConstantType(-big, 7) < RationalConstantType(min))
+
+  ASS_EQ(RationalConstantType(big * 2 + 1, 2).floor(), RationalConstantType(big))
+  ASS_EQ(RationalConstantType(big * 2 + 1, 2).ceiling(), RationalConstantType(big + 1))
+  ASS_EQ(RationalConstantType(-big * 2 - 1, 2).floor(), RationalConstantType(-big - 1))
+  ASS_EQ(RealConstantType(vstring("12345678901234567890.5")), RealConstantType(RationalConstantType(IntegerConstantType(vstring("24691357802469135781")), 2)))
+}
+
+TEST_FUN(real_exponents)
+{
+  vstring googol = vstring("1") + vstring(100, '0');
+
+  ASS_EQ(RealConstantType(vstring("1.0E100")), RealConstantType(RationalConstantType(IntegerConstantType(googol))))
+  ASS_EQ(RealConstantType(vstring("1.0E-100")), RealConstantType(RationalConstantType(1, IntegerConstantType(googol))))
+  ASS_EQ(RealConstantType(vstring("1.5E-3")), RealConstantType(RationalConstantType(3, 2000)))
+  ASS_EQ(RealConstantType(vstring("-2.5e+2")), RealConstantType(RationalConstantType(-250)))
+  ASS_EQ(RealConstantType(vstring("12345678901234567891e0")), RealConstantType(RationalConstantType(IntegerConstantType(vstring("12345678901234567891")))))
+  // 0.1 has no exact double representation
+  ASS_EQ(RealConstantType(vstring("0.1E1")), RealConstantType(RationalConstantType(1)))
+  ASS_EQ(RealConstantType(vstring("1E300")).numerator().toString(), vstring("1") + vstring(300, '0'))
+
+  try {
+    RealConstantType(vstring("1.0E2.5"));
+    ASSERTION_VIOLATION;
+  } catch (ArithmeticException&) {}
+}
@@ -584,36 +584,37 @@ INT_TEST(div_zero_2,
     r(remainderE(num(7), 0),     11     )
     )
 
+// results that do not fit into an int are checked through comparisons, as only int literals can be written here
+
 ALL_NUMBERS_TEST(eval_overflow_1,
-    p(num(1661992960) + 1661992960),
-    evaluationFail
+    num(1661992960) + 1661992960 > num(1661992960),
+    true
     )
 
 ALL_NUMBERS_TEST(eval_overflow_2,
-    r(num(1661992960) + 1661992960, num(7) + 3),
-    r(num(1661992960) + 1661992960, 10)
+    num(1661992960) + 1661992960 == num(1661992960) * 2,
+    true
     )
 
 ALL_NUMBERS_TEST(eval_overflow_3,
-    r(num(1661992960) * 1661992960, num(7) + 3),
-    r(num(1661992960) * 1661992960, 10)
+    num(1661992960) * 1661992960 > num(1661992960) * 1661992959,
+    true
     )
 
 ALL_NUMBERS_TEST(eval_overflow_4,
-    p(-1 * num(std::numeric_limits<int>::min())),
-    // p(-num(std::numeric_limits<int>::min()))
-    evaluationFail
+    -1 * num(std::numeric_limits<int>::min()) > num(std::numeric_limits<int>::max()),
+    true
     )
 
 ALL_NUMBERS_TEST(eval_overflow_5,
-    p(std::numeric_limits<int>::min() * num(std::numeric_limits<int>::min() + 1) * std::numeric_limits<int>::min()),
-    evaluationFail
+    std::numeric_limits<int>::min() * num(std::numeric_limits<int>::min() + 1) * std::numeric_limits<int>::min() < 0,
+    true
     )
 
 FRACTIONAL_TEST(eval_overflow_6,
-    // p($sum(0.0555556,-1260453006.0)),
-    p(frac(5,90) + num(-1260453006)),
-    evaluationFail
+    // $sum(0.0555556,-1260453006.0) < -1260453005.0
+    frac(5,90) + num(-1260453006) < num(-1260453005),
+    true
     )
 
 FRACTIONAL_TEST(eval_overflow_7,
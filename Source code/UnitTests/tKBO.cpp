@@ -17,6 +17,9 @@
 #include "Test/SyntaxSugar.hpp"
 #include "Kernel/KBO.hpp"
 #include "Kernel/Ordering.hpp"
+#include "Kernel/SubstHelper.hpp"
+#include "Kernel/Substitution.hpp"
+#include "Indexing/ResultSubstitution.hpp"
 
 //////////////////////////////////////////////////////////////////////////////// 
 /////////////////////////////// HELPER FUNCTIONS /////////////////////////////// 
@@ -413,3 +416,77 @@ TEST_FUN(kbo_test22) {
 }
 
 
+
+/** A substitution retrieved from an index that binds the result variables by @b _subst */
+class BoundSubstitution
+: public Indexing::ResultSubstitution
+{
+public:
+  BoundSubstitution(Substitution& subst) : _subst(subst) {}
+  TermList applyToBoundResult(TermList t) override { return SubstHelper::apply(t, _subst); }
+  bool isIdentityOnQueryWhenResultBound() override { return true; }
+private:
+  Substitution& _subst;
+};
+
+/** Check that the instance comparator of @b lhs and @b rhs agrees with KBO::compare under @b subst */
+void checkInstanceComparator(const KBO& ord, TermList lhs, TermList rhs, Substitution& subst)
+{
+  Ordering::InstanceComparator* cmp = ord.createInstanceComparator(lhs, rhs);
+  ASS(cmp);
+  BoundSubstitution bound(subst);
+  TermList lhsS = SubstHelper::apply(lhs, subst);
+  TermList rhsS = SubstHelper::apply(rhs, subst);
+  ASS_EQ(cmp->isGreater(lhsS, rhsS, bound), ord.compare(lhsS, rhsS) == Ordering::GREATER)
+  delete cmp;
+}
+
+TEST_FUN(kbo_instance_comparator01) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC (f, {srt, srt}, srt)
+  DECL_FUNC (g, {srt}, srt)
+  DECL_CONST(c, srt)
+
+  auto ord = kbo(weights(make_pair(g, 2u)), weights());
+
+  TermList bindings[] = { c, g(c), g(g(z)), z, f(c, z) };
+  for (TermList bx : bindings) {
+    for (TermList by : bindings) {
+      Substitution subst;
+      subst.bind(0, bx);
+      subst.bind(1, by);
+      // commutativity and an equation that is not
+      // orientable because y occurs more often on the right
+      checkInstanceComparator(ord, f(x, y), f(y, x), subst);
+      checkInstanceComparator(ord, f(y, x), f(x, y), subst);
+      checkInstanceComparator(ord, g(f(x, y)), f(y, y), subst);
+      checkInstanceComparator(ord, f(y, y), g(f(x, y)), subst);
+    }
+  }
+}
+
+TEST_FUN(kbo_instance_comparator02) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC (f, {srt, srt}, srt)
+  DECL_FUNC (g, {srt}, srt)
+  DECL_CONST(c, srt)
+
+  auto ord = kbo(weights(), weights());
+
+  Ordering::InstanceComparator* cmp = ord.createInstanceComparator(f(x, y), f(y, x));
+  Substitution subst;
+  BoundSubstitution bound(subst);
+  subst.bind(0, g(c));
+  subst.bind(1, c);
+  ASS(cmp->isGreater(f(g(c), c), f(c, g(c)), bound))
+  subst.reset();
+  subst.bind(0, c);
+  subst.bind(1, g(c));
+  ASS(!cmp->isGreater(f(c, g(c)), f(g(c), c), bound))
+  delete cmp;
+
+  // variables are never rewritten, so there is nothing to compile
+  ASS(!ord.createInstanceComparator(x, g(x)))
+}
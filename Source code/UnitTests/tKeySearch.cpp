@@ -0,0 +1,65 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include <cstdlib>
+
+#include "Lib/KeySearch.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+
+/** Fill @b keys with @b length sorted distinct keys, including ones with the highest bit set */
+static void makeKeys(Stack<unsigned>& keys, unsigned length)
+{
+  keys.reset();
+  unsigned k = rand()%4;
+  for(unsigned i=0;i<length;i++) {
+    keys.push(k);
+    k += 1+rand()%4;
+    if(i==length/2) {
+      k |= 0x80000000u;
+    }
+  }
+}
+
+static size_t naiveLowerBound(const Stack<unsigned>& keys, unsigned key)
+{
+  size_t i=0;
+  while(i<keys.size() && keys[i]<key) {
+    i++;
+  }
+  return i;
+}
+
+TEST_FUN(keySearchLowerBound)
+{
+  Stack<unsigned> keys;
+  for(unsigned length=0;length<300;length++) {
+    makeKeys(keys,length);
+    for(unsigned i=0;i<length;i++) {
+      ASS_EQ(KeySearch::lowerBound(keys.begin(),length,keys[i]),i);
+      ASS_EQ(KeySearch::lowerBound(keys.begin(),length,keys[i]+1),naiveLowerBound(keys,keys[i]+1));
+    }
+    ASS_EQ(KeySearch::lowerBound(keys.begin(),length,0xFFFFFFFFu),naiveLowerBound(keys,0xFFFFFFFFu));
+    ASS_EQ(KeySearch::lowerBound(keys.begin(),length,0),0);
+  }
+}
+
+TEST_FUN(keySearchCountSmaller)
+{
+  unsigned keys[] = {1,2,3,5,8,13,0x80000000u,0x80000001u,0xFFFFFFFFu};
+  ASS_EQ(KeySearch::countSmaller(keys,9,0),0);
+  ASS_EQ(KeySearch::countSmaller(keys,9,4),3);
+  ASS_EQ(KeySearch::countSmaller(keys,9,14),6);
+  ASS_EQ(KeySearch::countSmaller(keys,9,0x80000001u),7);
+  ASS_EQ(KeySearch::countSmaller(keys,9,0xFFFFFFFFu),8);
+  ASS_EQ(KeySearch::countSmaller(keys,5,0xFFFFFFFFu),5);
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file tLispStreamReader.cpp
+ * Tests of reading Lisp and SMT-LIB2 input one top-level expression at a time.
+ */
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/VString.hpp"
+
+#include "Kernel/Formula.hpp"
+#include "Kernel/FormulaUnit.hpp"
+#include "Kernel/SortHelper.hpp"
+
+#include "Parse/SMTLIB2.hpp"
+
+#include "Shell/LispLexer.hpp"
+#include "Shell/LispParser.hpp"
+#include "Shell/Options.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace Lib;
+using namespace Kernel;
+using namespace Shell;
+
+/**
+ * Read all top-level expressions of @b input and return the message of the
+ * parser exception this raises, or the empty string if there is none
+ */
+vstring readAll(const char* input)
+{
+  vistringstream in(input);
+  LispLexer lexer(in);
+  LispParser parser(lexer);
+  LispStreamReader reader(parser);
+  try {
+    while (reader.hasNext()) {
+      reader.next();
+    }
+  } catch (LispParser::Exception& e) {
+    vostringstream out;
+    e.cry(out);
+    return out.str();
+  }
+  return "";
+}
+
+TEST_FUN(truncated_input)
+{
+  ASS_EQ(readAll("(set-logic UF)\n(declare-fun c () Bool)\n"), "")
+  ASS_EQ(readAll("(a)\n\n("), "Parser exception: unmatched left parenthesis in line 3 at \n")
+  ASS_EQ(readAll("(set-logic UF)\n(assert\n  (and c"), "Parser exception: unmatched left parenthesis in line 3 at \n")
+  ASS_EQ(readAll("(a))"), "Parser exception: unmatched right parenthesis in line 1 at )\n")
+}
+
+TEST_FUN(accept_eol)
+{
+  vistringstream in("(a b)\n(c)");
+  LispLexer lexer(in);
+  LispParser parser(lexer);
+  LispStreamReader reader(parser);
+
+  ASS_EQ(reader.next()->toString(), "(a b)")
+  try {
+    reader.acceptEOL();
+    ASSERTION_VIOLATION;
+  } catch (UserErrorException&) {}
+
+  // the expression looked at by acceptEOL is still returned
+  ASS_EQ(reader.next()->toString(), "(c)")
+  reader.acceptEOL();
+  ASS(!reader.hasNext());
+}
+
+TEST_FUN(define_sort_after_its_command)
+{
+  // the definition is expanded when the later commands are read, after the
+  // define-sort command itself has been destroyed
+  vistringstream in(
+      "(set-logic ALL)\n"
+      "(define-sort Table (X) (Array X X))\n"
+      "(declare-fun a () (Table Int))\n"
+      "(declare-fun b () (Table Int))\n"
+      "(assert (= a b))\n"
+      "(check-sat)\n");
+  Parse::SMTLIB2 parser(*env.options);
+  parser.parse(in);
+
+  UnitList* units = parser.getFormulas();
+  ASS_EQ(UnitList::length(units), 1);
+  Formula* f = static_cast<FormulaUnit*>(units->head())->formula();
+  ASS_EQ(f->connective(), LITERAL);
+  TermList sort = SortHelper::getEqualityArgumentSort(f->literal());
+  ASS(sort.isArraySort());
+  ASS_EQ(sort, AtomicSort::arraySort(AtomicSort::intSort(), AtomicSort::intSort()));
+}
@@ -67,3 +67,23 @@ TEST_FUN(urr)
     ASS(!testGlobal(o));
   } 
 }
+
+TEST_FUN(preprocessing_fingerprint)
+{
+  // the sine level split queues need the sine levels computed during preprocessing,
+  // so a problem preprocessed without them cannot be shared with a slice using them
+  Options plain;
+  Options slsq;
+  slsq.set("sine_level_split_queue","on");
+  ASS_NEQ(plain.generateEncodedPreprocessingOptions(), slsq.generateEncodedPreprocessingOptions());
+
+  Options slsqRatios;
+  slsqRatios.set("sine_level_split_queue","on");
+  slsqRatios.set("sine_level_split_queue_ratios","1,4,9");
+  ASS_NEQ(slsq.generateEncodedPreprocessingOptions(), slsqRatios.generateEncodedPreprocessingOptions());
+
+  // a purely saturation option does not change the fingerprint
+  Options awr;
+  awr.set("age_weight_ratio","1:4");
+  ASS_EQ(plain.generateEncodedPreprocessingOptions(), awr.generateEncodedPreprocessingOptions());
+}
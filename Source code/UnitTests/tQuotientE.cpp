@@ -36,47 +36,65 @@ bool operator<=(int lhs, IntegerConstantType rhs) {
   return IntegerConstantType(lhs) <= rhs;
 }
 
+/** Decimal representation of @b n, computed without IntegerConstantType */
+vstring oracleToString(__int128 n)
+{
+  if (n == 0) {
+    return "0";
+  }
+  bool neg = n < 0;
+  vstring res;
+  while (n != 0) {
+    int digit = (int)(n % 10);
+    res.insert(res.begin(), '0' + (neg ? -digit : digit));
+    n /= 10;
+  }
+  return neg ? "-" + res : res;
+}
+
+/**
+ * Check @b q and @b r against the Euclidean quotient and remainder of
+ * @b i and @b j computed in 128 bit machine arithmetic
+ */
+void checkAgainstOracle(__int128 i, __int128 j, const IntegerConstantType& q, const IntegerConstantType& r)
+{
+  __int128 eq = i / j;
+  __int128 er = i % j;
+  if (er < 0) {
+    if (j > 0) {
+      eq--;
+      er += j;
+    } else {
+      eq++;
+      er -= j;
+    }
+  }
+  ASS_EQ(q.toString(), oracleToString(eq))
+  ASS_EQ(r.toString(), oracleToString(er))
+}
+
 TEST_FUN(check_spec) {
   for (int j = std::numeric_limits<int>::min();;) {
     for (int i = std::numeric_limits<int>::min();;) {
 
       DEBUG();
 
-      bool bothOK = true;
-
-      IntegerConstantType q;
-      try {
-        q = quotientE(i, j);
+      if (j == 0) {
+        try {
+          quotientE(i, j);
+          ASSERTION_VIOLATION;
+        } catch (DivByZeroException&) {}
+        try {
+          remainderE(i, j);
+          ASSERTION_VIOLATION;
+        } catch (ArithmeticException&) {}
+      } else {
+        // the quotient need not fit into an int (e.g. for INT_MIN and -1)
+        IntegerConstantType q = quotientE(i, j);
+        IntegerConstantType r = remainderE(i, j);
         DEBUG("quotientE (", i, ", ", j, ")\t= ", q);
-      } catch (MachineArithmeticException&) {
-        DEBUG("quotientE (", i, ", ", j, ")\t= MachineArithmeticException");
-        bothOK = false;
-      } catch (DivByZeroException&) {
-        ASS_EQ(j, 0);
-        bothOK = false;
-      }
-
-      IntegerConstantType r;
-      try {
-        r = remainderE(i, j);
         DEBUG("remainderE(", i, ", ", j, ")\t= ", r);
-      } catch (MachineArithmeticException&) {
-        DEBUG("remainderE(", i, ", ", j, ")\t= MachineArithmeticException");
-        bothOK = false;
-      } catch (DivByZeroException&) {
-        ASS_EQ(j, 0);
-        bothOK = false;
-      }
-
-      if (bothOK) {
-        // do the math 64 bit
-        long long int I = i;
-        long long int J = j;
-        long long int Q = q.toInner();
-        long long int R = r.toInner();
-
-        ASS_EQ(Q * J + R, I)
-        ASS(0 <= R && R < abs(J))
+        checkAgainstOracle(i, j, q, r);
       }
       if (i == std::numeric_limits<int>::max()) {
         break;
@@ -125,6 +143,23 @@ void checkQuotientE(Const i, Const j) {
   }
 }
 
+TEST_FUN(check_int64)
+{
+  long long values[] = {
+    std::numeric_limits<long long>::min(), std::numeric_limits<long long>::min() + 1,
+    -(1ll << 62) - 7, -(1ll << 32) - 1, -(1ll << 32), -(1ll << 31) - 1, -(1ll << 31),
+    -1000000007, -3, -1, 1, 2, 7, (1ll << 31) - 1, 1ll << 31, (1ll << 32) + 1,
+    (1ll << 62) + 5, std::numeric_limits<long long>::max() - 1, std::numeric_limits<long long>::max(),
+  };
+  for (long long i : values) {
+    for (long long j : values) {
+      IntegerConstantType I(oracleToString(i));
+      IntegerConstantType J(oracleToString(j));
+      checkAgainstOracle(i, j, I.quotientE(J), I.remainderE(J));
+    }
+  }
+}
+
 TEST_FUN(check_int) 
 {
   int range = 10;
@@ -9,6 +9,7 @@
  */
 
 #include "Lib/List.hpp"
+#include "Lib/Random.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/Environment.hpp"
 
@@ -16,6 +17,7 @@
 #include "SAT/SATLiteral.hpp"
 #include "SAT/SATInference.hpp"
 #include "SAT/SATSolver.hpp"
+#include "SAT/CDCLSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
@@ -140,6 +142,9 @@ TEST_FUN(testProofWithAssums)
 {
   MinisatInterfacing s(*env.options,true);
   testProofWithAssumptions(s);    
+
+  CDCLSolver sCDCL(*env.options,true);
+  testProofWithAssumptions(sCDCL);
 }
 
 void testInterface(SATSolverWithAssumptions &s) {
@@ -231,6 +236,10 @@ TEST_FUN(testSATSolverInterface)
   cout << endl << "Minisat" << endl;  
   MinisatInterfacing sMini(*env.options,true);
   testInterface(sMini);
+
+  cout << endl << "CDCL" << endl;
+  CDCLSolver sCDCL(*env.options,true);
+  testInterface(sCDCL);
     
   /* Not fully conforming - does not support zeroImplied and resource-limited solving
   cout << endl << "Z3" << endl;
@@ -292,6 +301,10 @@ TEST_FUN(testSolvingUnderAssumptions)
   MinisatInterfacing sMini(*env.options,true);
   testAssumptions(sMini);
 
+  cout << endl << "CDCL" << endl;
+  CDCLSolver sCDCL(*env.options,true);
+  testAssumptions(sCDCL);
+
   /*cout << endl << "Z3" << endl;
   {
     SAT2FO sat2fo;
@@ -299,3 +312,136 @@ TEST_FUN(testSolvingUnderAssumptions)
     testAssumptions(sZ3);
   }*/
 }
+
+/**
+ * Random 3-SAT instance with @b varCnt variables and @b clauseCnt clauses
+ */
+void randomClauses(unsigned varCnt, unsigned clauseCnt, SATClauseStack& acc)
+{
+  CALL("randomClauses");
+
+  SATLiteralStack lits;
+  for (unsigned i = 0; i < clauseCnt; i++) {
+    lits.reset();
+    while (lits.size() < 3) {
+      unsigned var = 1 + Random::getInteger(varCnt);
+      bool fresh = true;
+      for (unsigned j = 0; j < lits.size(); j++) {
+        fresh &= lits[j].var() != var;
+      }
+      if (fresh) {
+        lits.push(SATLiteral(var, Random::getBit()));
+      }
+    }
+    acc.push(SATClause::fromStack(lits));
+  }
+}
+
+bool satisfiedByModel(SATSolver& s, const SATClauseStack& clauses)
+{
+  CALL("satisfiedByModel");
+
+  for (unsigned i = 0; i < clauses.size(); i++) {
+    bool sat = false;
+    for (unsigned j = 0; j < clauses[i]->length(); j++) {
+      sat |= s.trueInAssignment((*clauses[i])[j]);
+    }
+    if (!sat) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Compare CDCLSolver with Minisat on random instances around the phase
+ * transition, adding the clauses incrementally and solving under
+ * random assumptions in between.
+ */
+TEST_FUN(testCDCLAgainstMinisat)
+{
+  const unsigned varCnt = 120;
+
+  Random::setSeed(1);
+  for (unsigned round = 0; round < 20; round++) {
+    MinisatInterfacing sMini(*env.options,true);
+    CDCLSolver sCDCL(*env.options,true);
+    SATSolverWithAssumptions& mini = sMini;
+    SATSolverWithAssumptions& cdcl = sCDCL;
+    mini.ensureVarCount(varCnt);
+    cdcl.ensureVarCount(varCnt);
+
+    SATClauseStack clauses;
+    for (unsigned step = 0; step < 6; step++) {
+      SATClauseStack added;
+      randomClauses(varCnt, 90, added);
+      for (unsigned i = 0; i < added.size(); i++) {
+        mini.addClause(added[i]);
+        cdcl.addClause(added[i]);
+        clauses.push(added[i]);
+      }
+
+      SATSolver::Status st = cdcl.solve();
+      ASS_EQ(st, mini.solve());
+      if (st == SATSolver::UNSATISFIABLE) {
+        break;
+      }
+      ASS(satisfiedByModel(cdcl, clauses));
+
+      SATLiteralStack assumps;
+      for (unsigned i = 0; i < 10; i++) {
+        assumps.push(SATLiteral(1 + Random::getInteger(varCnt), Random::getBit()));
+      }
+      st = cdcl.solveUnderAssumptions(assumps);
+      ASS_EQ(st, mini.solveUnderAssumptions(assumps));
+      if (st == SATSolver::SATISFIABLE) {
+        ASS(satisfiedByModel(cdcl, clauses));
+        for (unsigned i = 0; i < assumps.size(); i++) {
+          ASS(cdcl.trueInAssignment(assumps[i]));
+        }
+      } else {
+        // the failed assumptions alone have to be inconsistent with the clauses
+        SATLiteralStack failed = cdcl.failedAssumptions();
+        ASS_EQ(mini.solveUnderAssumptions(failed), SATSolver::UNSATISFIABLE);
+      }
+    }
+  }
+}
+
+/**
+ * Refute many fresh assumptions p_k, each by its own pair of binary clauses,
+ * below more than CHRONO_DISTANCE (see CDCLSolver.cpp) true assumptions.
+ * Once enough conflicts have been seen, the learnt unit ~p_k is put on the trail
+ * by chronological backtracking above the first assumption, without going
+ * back to level 0. It must not be taken for a failed assumption then.
+ */
+TEST_FUN(testCDCLFailedAssumptionsWithChronoBacktracking)
+{
+  const unsigned dummyCnt = 150;
+  const unsigned rounds = 4500;
+
+  CDCLSolver sCDCL(*env.options,true);
+  SATSolverWithAssumptions& s = sCDCL;
+  s.ensureVarCount(dummyCnt + 2*rounds);
+
+  for (unsigned k = 0; k < rounds; k++) {
+    SATLiteral p(dummyCnt + 2*k + 1, true);
+    SATLiteral q(dummyCnt + 2*k + 2, true);
+    SATLiteralStack lits({ p.opposite(), q });
+    s.addClause(SATClause::fromStack(lits));
+    lits = { p.opposite(), q.opposite() };
+    s.addClause(SATClause::fromStack(lits));
+
+    // the assumptions are decided from the top of the stack, p comes last
+    SATLiteralStack assumps;
+    assumps.push(p);
+    for (unsigned i = 1; i <= dummyCnt; i++) {
+      assumps.push(SATLiteral(i, true));
+    }
+    ASS_EQ(s.solveUnderAssumptions(assumps), SATSolver::UNSATISFIABLE);
+
+    const SATLiteralStack& failed = s.failedAssumptions();
+    ASS_EQ(failed.size(), 1);
+    ASS_EQ(failed[0], p);
+  }
+}
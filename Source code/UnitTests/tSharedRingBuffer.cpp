@@ -0,0 +1,143 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file tSharedRingBuffer.cpp
+ * Tests of the ring buffer shared between forked processes.
+ */
+
+#include "Lib/Portability.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#include <cerrno>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "Lib/Stack.hpp"
+
+#include "Lib/Sys/Multiprocessing.hpp"
+#include "Lib/Sys/SharedRingBuffer.hpp"
+
+using namespace Lib;
+using namespace Lib::Sys;
+
+/**
+ * Publish records (i, i*i) for i from @b first to @b last (exclusive)
+ * in a forked process, so that the current process may read them
+ */
+void publishInChild(SharedRingBuffer& buf, unsigned first, unsigned last)
+{
+  pid_t fres=Multiprocessing::instance()->fork();
+  ASS_NEQ(fres,-1);
+  if(!fres) {
+    for(unsigned i=first;i<last;i++) {
+      unsigned rec[2] = { i, i*i };
+      if(!buf.publish(rec,2)) {
+        exit(1);
+      }
+    }
+    exit(0);
+  }
+
+  int status;
+  errno=0;
+  pid_t res=waitpid(fres, &status, 0);
+  if(res==-1) {
+    SYSTEM_FAIL("Error in waiting for forked process.",errno);
+  }
+  ASS(WIFEXITED(status));
+  ASS_EQ(WEXITSTATUS(status),0);
+}
+
+void checkRecord(const Stack<unsigned>& record, unsigned i)
+{
+  ASS_EQ(record.size(),2);
+  ASS_EQ(record[0],i);
+  ASS_EQ(record[1],i*i);
+}
+
+TEST_FUN(ringbuffer_empty)
+{
+  SharedRingBuffer buf(4,2);
+  unsigned long pos=0;
+  Stack<unsigned> record;
+  ASS_EQ(buf.published(),0);
+  ASS(!buf.read(pos,record));
+  ASS_EQ(pos,0);
+
+  // a record that does not fit into a slot is refused
+  unsigned rec[3] = { 1, 2, 3 };
+  ASS(!buf.publish(rec,3));
+  ASS_EQ(buf.published(),0);
+}
+
+TEST_FUN(ringbuffer_skips_own_records)
+{
+  SharedRingBuffer buf(4,2);
+  unsigned rec[2] = { 7, 49 };
+  ASS(buf.publish(rec,2));
+  ASS_EQ(buf.published(),1);
+
+  unsigned long pos=0;
+  Stack<unsigned> record;
+  ASS(!buf.read(pos,record));
+  ASS_EQ(pos,1);
+
+  publishInChild(buf,8,9);
+  ASS(buf.read(pos,record));
+  checkRecord(record,8);
+  ASS(!buf.read(pos,record));
+}
+
+TEST_FUN(ringbuffer_wrap_around)
+{
+  SharedRingBuffer buf(4,2);
+  unsigned long pos=0;
+  Stack<unsigned> record;
+
+  publishInChild(buf,0,3);
+  for(unsigned i=0;i<3;i++) {
+    ASS(buf.read(pos,record));
+    checkRecord(record,i);
+  }
+  ASS(!buf.read(pos,record));
+
+  // these go to slots 3, 0 and 1
+  publishInChild(buf,3,6);
+  for(unsigned i=3;i<6;i++) {
+    ASS(buf.read(pos,record));
+    checkRecord(record,i);
+  }
+  ASS(!buf.read(pos,record));
+  ASS_EQ(pos,6);
+}
+
+TEST_FUN(ringbuffer_full)
+{
+  SharedRingBuffer buf(4,2);
+  unsigned long pos=0;
+  Stack<unsigned> record;
+
+  // exactly full, nothing is lost yet
+  publishInChild(buf,0,4);
+  ASS(buf.read(pos,record));
+  checkRecord(record,0);
+
+  // the reader falls behind, only the last four records survive
+  publishInChild(buf,4,10);
+  ASS_EQ(buf.published(),10);
+  for(unsigned i=6;i<10;i++) {
+    ASS(buf.read(pos,record));
+    checkRecord(record,i);
+  }
+  ASS(!buf.read(pos,record));
+  ASS_EQ(pos,10);
+}
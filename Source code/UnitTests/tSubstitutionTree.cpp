@@ -0,0 +1,196 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+#include "Lib/Environment.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/Sort.hpp"
+#include "Lib/Stack.hpp"
+
+#include "Shell/Options.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/OperatorType.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/Term.hpp"
+
+#include "Indexing/TermSubstitutionTree.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+using namespace Kernel;
+using namespace Indexing;
+
+/*
+ * The tests build the same index with both node layouts (see the
+ * index_node_layout option) and check that all retrievals return
+ * the same results.
+ */
+
+#define CONSTANTS 20
+#define COPIES 8
+
+static unsigned functionSymbol(const char* name, unsigned arity)
+{
+  bool added;
+  unsigned f = env.signature->addFunction(name,arity,added);
+  if(added) {
+    TermList srt = AtomicSort::defaultSort();
+    env.signature->getFunction(f)->setType(OperatorType::getFunctionTypeUniformRange(arity,srt,srt));
+  }
+  return f;
+}
+
+static unsigned predicateSymbol(const char* name)
+{
+  bool added;
+  unsigned p = env.signature->addPredicate(name,1,added);
+  if(added) {
+    env.signature->getPredicate(p)->setType(OperatorType::getPredicateTypeUniformRange(1,AtomicSort::defaultSort()));
+  }
+  return p;
+}
+
+static TermList constant(unsigned i)
+{
+  vstring name = "c" + Int::toString(i);
+  return TermList(Term::createConstant(functionSymbol(name.c_str(),0)));
+}
+
+static TermList f(TermList t)
+{ return TermList(Term::create1(functionSymbol("f",1),t)); }
+
+static TermList g(TermList t1, TermList t2)
+{ return TermList(Term::create2(functionSymbol("g",2),t1,t2)); }
+
+static TermList var(unsigned i)
+{ return TermList(i,false); }
+
+struct Entry {
+  TermList term;
+  Literal* literal;
+  Clause* clause;
+};
+
+/** Return indexed terms, each of them COPIES times in different clauses */
+static Stack<Entry>& entries()
+{
+  static Stack<Entry> res;
+  if(res.isNonEmpty()) {
+    return res;
+  }
+  Stack<TermList> terms;
+  for(unsigned i=0;i<CONSTANTS;i++) {
+    terms.push(constant(i));
+    terms.push(f(constant(i)));
+    terms.push(g(constant(i),var(0)));
+    terms.push(g(var(0),constant(i)));
+    terms.push(g(constant(i),constant((i*7)%CONSTANTS)));
+    terms.push(g(f(constant(i)),var(1)));
+  }
+  terms.push(var(0));
+  terms.push(g(var(0),var(1)));
+
+  unsigned p = predicateSymbol("p");
+  for(unsigned i=0;i<terms.size();i++) {
+    for(unsigned j=0;j<COPIES;j++) {
+      Literal* lit = Literal::create1(p,true,terms[i]);
+      Clause* cl = new(1) Clause(1,NonspecificInference0(UnitInputType::AXIOM,InferenceRule::INPUT));
+      (*cl)[0] = lit;
+      res.push(Entry{terms[i],lit,cl});
+    }
+  }
+  return res;
+}
+
+static Stack<TermList>& queries()
+{
+  static Stack<TermList> res;
+  if(res.isEmpty()) {
+    for(unsigned i=0;i<CONSTANTS;i+=3) {
+      res.push(constant(i));
+      res.push(f(constant(i)));
+      res.push(f(var(2)));
+      res.push(g(constant(i),var(2)));
+      res.push(g(var(2),constant(i)));
+      res.push(g(constant(i),constant((i*7)%CONSTANTS)));
+      res.push(g(f(constant(i)),constant(i)));
+    }
+    res.push(var(2));
+    res.push(g(var(2),var(3)));
+  }
+  return res;
+}
+
+/**
+ * Return the numbers of clauses retrieved for all queries, each
+ * group sorted and terminated by 0
+ */
+static Stack<unsigned> retrieve(TermSubstitutionTree& tree)
+{
+  Stack<unsigned> res;
+  for(unsigned i=0;i<queries().size();i++) {
+    TermList q = queries()[i];
+    for(unsigned kind=0;kind<3;kind++) {
+      TermQueryResultIterator it = kind==0 ? tree.getUnifications(q,true)
+	  : kind==1 ? tree.getGeneralizations(q,true) : tree.getInstances(q,true);
+      size_t start = res.size();
+      while(it.hasNext()) {
+        res.push(it.next().clause->number());
+      }
+      sort<Int>(res.begin()+start,res.end());
+      res.push(0);
+    }
+  }
+  return res;
+}
+
+static Stack<unsigned> retrieveWithLayout(const char* layout, bool removeHalf)
+{
+  env.options->set("index_node_layout",layout);
+  TermSubstitutionTree tree;
+  Stack<Entry>& es = entries();
+  for(unsigned i=0;i<es.size();i++) {
+    tree.insert(es[i].term,es[i].literal,es[i].clause);
+  }
+  if(removeHalf) {
+    for(unsigned i=0;i<es.size();i+=2) {
+      tree.remove(es[i].term,es[i].literal,es[i].clause);
+    }
+  }
+  Stack<unsigned> res = retrieve(tree);
+  for(unsigned i=removeHalf ? 1 : 0;i<es.size();i+=removeHalf ? 2 : 1) {
+    tree.remove(es[i].term,es[i].literal,es[i].clause);
+  }
+  env.options->set("index_node_layout","skip_list");
+  return res;
+}
+
+static void checkSame(const Stack<unsigned>& s1, const Stack<unsigned>& s2)
+{
+  ASS_EQ(s1.size(),s2.size());
+  for(unsigned i=0;i<s1.size();i++) {
+    ASS_EQ(s1[i],s2[i]);
+  }
+}
+
+TEST_FUN(sortedArrayLayoutRetrieval)
+{
+  Stack<unsigned> skipList = retrieveWithLayout("skip_list",false);
+  Stack<unsigned> sortedArray = retrieveWithLayout("sorted_array",false);
+  ASS_G(skipList.size(),queries().size()*3);
+  checkSame(skipList,sortedArray);
+}
+
+TEST_FUN(sortedArrayLayoutRemoval)
+{
+  Stack<unsigned> skipList = retrieveWithLayout("skip_list",true);
+  Stack<unsigned> sortedArray = retrieveWithLayout("sorted_array",true);
+  checkSame(skipList,sortedArray);
+}
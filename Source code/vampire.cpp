@@ -67,6 +67,7 @@
 #include "Shell/Property.hpp"
 #include "Saturation/ProvingHelper.hpp"
 #include "Shell/Preprocess.hpp"
+#include "Shell/PreprocessingCache.hpp"
 #include "Shell/TheoryFinder.hpp"
 #include "Shell/TPTPPrinter.hpp"
 #include "Parse/TPTP.hpp"
@@ -141,6 +142,19 @@ Problem* getPreprocessedProblem()
 {
   CALL("getPreprocessedProblem");
 
+  PreprocessingCache cache(*env.options);
+  if (cache.enabled()) {
+    TimeCounter tc(TC_PARSING);
+    Problem* prb = cache.load();
+    if (prb) {
+      // the input problem is not parsed, so check against the cached clauses
+      if (env.options->mode()!=Options::Mode::SPIDER) {
+        env.options->checkProblemOptionConstraints(prb->getProperty(), /*before_preprocessing = */ true);
+      }
+      return prb;
+    }
+  }
+
   Problem* prb = UIHelper::getInputProblem(*env.options);
 
   TimeCounter tc2(TC_PREPROCESSING);
@@ -153,7 +167,10 @@ Problem* getPreprocessedProblem()
   Shell::Preprocess prepro(*env.options);
   //phases for preprocessing are being set inside the preprocess method
   prepro.preprocess(*prb);
-  
+
+  if (cache.enabled()) {
+    cache.store(*prb);
+  }
   return prb;
 } // getPreprocessedProblem
 
@@ -722,6 +739,7 @@ int main(int argc, char* argv[])
     TimeCounter::reinitialize();
 
     Allocator::setMemoryLimit(env.options->memoryLimit() * 1048576ul);
+    Allocator::setReleaseFreedPages(env.options->releaseFreedMemory());
     Lib::Random::setSeed(env.options->randomSeed());
 
     switch (env.options->mode())